@@ -0,0 +1,211 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+#include "mpsc_ring.hpp"
+
+namespace Util
+{
+    // Asynchronous logger: callers push records into a lock-free ring and a
+    // background thread formats them and hands them to the sink. When the
+    // ring is full the message is dropped and counted instead of blocking.
+    // Before start() and after stop(), messages go straight to the sink.
+    // Formatted posts need <format>, preformatted ones work without it.
+    // Owners stop() it explicitly: a global instance must not be left to
+    // join its thread from a static destructor (under the loader lock).
+    template <std::size_t Capacity = 256, std::size_t RecordSize = 512>
+    class async_logger
+    {
+    public:
+        using sink_t = void (*)(const char* message);
+
+        explicit async_logger(const sink_t sink) noexcept : sink_(sink)
+        {
+        }
+
+        ~async_logger()
+        {
+            stop();
+        }
+
+        async_logger(const async_logger&) = delete;
+        async_logger& operator=(const async_logger&) = delete;
+
+        void start()
+        {
+            if (running_.exchange(true)) return;
+            worker_ = std::thread([this] { drain_loop(); });
+        }
+
+        // Flush everything queued and stop the background thread
+        void stop()
+        {
+            if (!running_.exchange(false)) return;
+
+            wake();
+            if (worker_.joinable()) worker_.join();
+
+            // Posts that saw the logger running may still be filling their
+            // records: wait for them, then drain whatever the worker missed
+            while (producers_.load() > 0)
+                std::this_thread::yield();
+            drain();
+        }
+
+        [[nodiscard]] bool running() const noexcept
+        {
+            return running_.load(std::memory_order_relaxed);
+        }
+
+        // Number of messages dropped since the last report
+        [[nodiscard]] std::uint64_t dropped() const noexcept
+        {
+            return dropped_.load(std::memory_order_relaxed);
+        }
+
+        // Queue a preformatted message (truncated to the record size)
+        void post(const std::string_view message)
+        {
+            if (!enqueue([message](record& r)
+            {
+                r.format = nullptr;
+                r.length = std::min(message.size(), RecordSize - 1);
+                std::memcpy(r.payload, message.data(), r.length);
+                r.payload[r.length] = '\0';
+            }))
+                sink_(std::string(message).c_str());
+        }
+
+#if __has_include(<format>)
+        // Queue a message formatted on the background thread. Arithmetic
+        // arguments are captured by value; anything else (strings, pointers
+        // that may dangle) is formatted right away.
+        template <typename... Args>
+        void post(std::format_string<Args...> fmt, Args&&... args)
+        {
+            using tuple_t = std::tuple<std::decay_t<Args>...>;
+            constexpr auto deferrable = (std::is_arithmetic_v<std::decay_t<Args>> && ...) &&
+                sizeof(tuple_t) <= RecordSize && alignof(tuple_t) <= alignof(std::max_align_t);
+
+            if constexpr (!deferrable)
+            {
+                post(std::format(fmt, std::forward<Args>(args)...));
+            }
+            else
+            {
+                if (!enqueue([&](record& r)
+                {
+                    r.format = &format_deferred<tuple_t>;
+                    r.fmt = fmt.get();
+                    new(r.payload) tuple_t(args...);
+                }))
+                    sink_(std::format(fmt, std::forward<Args>(args)...).c_str());
+            }
+        }
+#endif
+
+    private:
+        struct record
+        {
+            void (*format)(const record&, std::string&);
+            std::string_view fmt;
+            std::size_t length;
+            alignas(std::max_align_t) char payload[RecordSize];
+        };
+
+#if __has_include(<format>)
+        template <typename Tuple>
+        static void format_deferred(const record& r, std::string& out)
+        {
+            const auto& args = *std::launder(reinterpret_cast<const Tuple*>(r.payload));
+            out = std::apply([&](const auto&... values)
+            {
+                return std::vformat(r.fmt, std::make_format_args(values...));
+            }, args);
+        }
+#endif
+
+        // Push a record unless the logger is stopped (false: write it directly).
+        // The producer count is raised before running_ is checked, so stop()
+        // either sees this post in flight or this post sees it stopped.
+        template <typename Fill>
+        bool enqueue(Fill&& fill)
+        {
+            producers_.fetch_add(1);
+            if (!running_.load())
+            {
+                producers_.fetch_sub(1, std::memory_order_release);
+                return false;
+            }
+
+            if (ring_.try_push(std::forward<Fill>(fill))) wake();
+            else dropped_.fetch_add(1, std::memory_order_relaxed);
+
+            producers_.fetch_sub(1, std::memory_order_release);
+            return true;
+        }
+
+        void wake()
+        {
+            if (!signaled_.exchange(true, std::memory_order_acq_rel))
+                signaled_.notify_one();
+        }
+
+        void drain()
+        {
+            std::string formatted;
+            while (ring_.try_pop([&](record& r)
+            {
+                if (r.format)
+                {
+                    r.format(r, formatted);
+                    sink_(formatted.c_str());
+                }
+                else sink_(r.payload);
+            }))
+            {
+            }
+
+            if (const auto dropped = dropped_.exchange(0, std::memory_order_relaxed); dropped > 0)
+            {
+                char report[80];
+                std::snprintf(report, sizeof(report), "[%llu log message(s) dropped, the log queue was full]",
+                              static_cast<unsigned long long>(dropped));
+                sink_(report);
+            }
+        }
+
+        void drain_loop()
+        {
+            while (running())
+            {
+                signaled_.wait(false, std::memory_order_acquire);
+                signaled_.store(false, std::memory_order_relaxed);
+                drain();
+            }
+        }
+
+        sink_t sink_;
+        mpsc_ring<record, Capacity> ring_;
+
+        std::atomic<bool> running_{false};
+        std::atomic<bool> signaled_{false};
+        std::atomic<std::uint64_t> dropped_{0};
+        std::atomic<std::uint32_t> producers_{0}; // Posts in flight
+        std::thread worker_;
+    };
+}
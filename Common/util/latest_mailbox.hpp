@@ -0,0 +1,66 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+#include "seqlock.hpp"
+
+namespace Util
+{
+    // Single-slot, latest-wins mailbox. Any number of writers replace the
+    // pending value without waiting, a single reader takes at most one value
+    // per call and counts the ones that were replaced before it got to them.
+    template <typename T>
+    class latest_mailbox
+    {
+    public:
+        latest_mailbox() = default;
+
+        // Copies take the current value, with nothing pending
+        latest_mailbox(const latest_mailbox& other) noexcept :
+            slot_(other.slot_), overwritten_(other.overwritten())
+        {
+        }
+
+        latest_mailbox& operator=(const latest_mailbox& other) noexcept
+        {
+            if (this != &other)
+            {
+                slot_.store(other.slot_.load());
+                taken_version_ = slot_.version();
+                overwritten_.store(other.overwritten(), std::memory_order_relaxed);
+            }
+            return *this;
+        }
+
+        // Replace the pending value (wait-free unless another writer is mid-store)
+        void post(const T& value) noexcept
+        {
+            slot_.store(value);
+        }
+
+        // Take the pending value, false if nothing was posted since the last take. Reader only.
+        bool take(T& out) noexcept
+        {
+            std::uint32_t version;
+            if (!slot_.try_load(out, &version) || version == taken_version_) return false;
+
+            // Every store bumps the sequence by 2, all but the last one were never taken
+            if (const auto posted = (version - taken_version_) / 2; posted > 1)
+                overwritten_.fetch_add(posted - 1, std::memory_order_relaxed);
+
+            taken_version_ = version;
+            return true;
+        }
+
+        // Values replaced before the reader took them
+        [[nodiscard]] std::uint64_t overwritten() const noexcept
+        {
+            return overwritten_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        seqlock<T> slot_;
+        std::uint32_t taken_version_ = 0; // Reader only
+        std::atomic<std::uint64_t> overwritten_{0};
+    };
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace Util
+{
+    // Bounded lock-free multi-producer, single-consumer ring.
+    // Elements are filled and consumed in place, so large records aren't copied twice.
+    template <typename T, std::size_t Capacity>
+    class mpsc_ring
+    {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+        struct cell
+        {
+            std::atomic<std::size_t> sequence;
+            T value;
+        };
+
+    public:
+        mpsc_ring() noexcept
+        {
+            for (std::size_t i = 0; i < Capacity; i++)
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        mpsc_ring(const mpsc_ring&) = delete;
+        mpsc_ring& operator=(const mpsc_ring&) = delete;
+
+        // Claim a slot and fill it with fill(T&), fails without waiting if full
+        template <typename Fill>
+        bool try_push(Fill&& fill) noexcept(noexcept(fill(std::declval<T&>())))
+        {
+            auto position = head_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                auto& slot = cells_[position & (Capacity - 1)];
+                const auto sequence = slot.sequence.load(std::memory_order_acquire);
+                const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+                if (difference == 0)
+                {
+                    if (head_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        fill(slot.value);
+                        slot.sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0) return false; // Full
+                else position = head_.load(std::memory_order_relaxed);
+            }
+        }
+
+        // Consume the oldest element with consume(T&) (single consumer only)
+        template <typename Consume>
+        bool try_pop(Consume&& consume) noexcept(noexcept(consume(std::declval<T&>())))
+        {
+            auto& slot = cells_[tail_ & (Capacity - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != tail_ + 1)
+                return false; // Empty (or the producer is still filling it)
+
+            consume(slot.value);
+            slot.sequence.store(tail_ + Capacity, std::memory_order_release);
+            tail_++;
+            return true;
+        }
+
+    private:
+        alignas(64) std::atomic<std::size_t> head_{0};
+        alignas(64) std::size_t tail_ = 0;
+        alignas(64) cell cells_[Capacity];
+    };
+}
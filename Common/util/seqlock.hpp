@@ -0,0 +1,90 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace Util
+{
+    // Sequence lock. Writers claim the sequence with a CAS (so concurrent
+    // writers serialize without a mutex), readers retry while a write is in
+    // flight. Standard layout and lock-free, so it may live in memory shared
+    // between processes, as long as writers there claim it the same way
+    // (see PoseChannel.cs).
+    template <typename T>
+    struct alignas(64) seqlock
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "seqlock payload must be trivially copyable");
+        static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "seqlock requires lock-free atomics");
+
+        std::atomic<std::uint32_t> sequence{0};
+        T value{};
+
+        seqlock() = default;
+
+        explicit seqlock(const T& initial) noexcept : value(initial)
+        {
+        }
+
+        // Copies take a consistent snapshot of the source
+        seqlock(const seqlock& other) noexcept : value(other.load())
+        {
+        }
+
+        seqlock& operator=(const seqlock& other) noexcept
+        {
+            if (this != &other) store(other.load());
+            return *this;
+        }
+
+        // Publish a new value
+        void store(const T& new_value) noexcept
+        {
+            // Claim the sequence: even -> odd
+            auto seq = sequence.load(std::memory_order_relaxed);
+            do seq &= ~1u;
+            while (!sequence.compare_exchange_weak(seq, seq + 1, std::memory_order_relaxed));
+            std::atomic_thread_fence(std::memory_order_release);
+
+            std::memcpy(&value, &new_value, sizeof(T));
+            sequence.store(seq + 2, std::memory_order_release);
+        }
+
+        // Read a consistent snapshot, gives up after a few torn attempts
+        bool try_load(T& out, std::uint32_t* version = nullptr, int attempts = 4) const noexcept
+        {
+            for (; attempts > 0; attempts--)
+            {
+                const auto before = sequence.load(std::memory_order_acquire);
+                if (before & 1) continue; // Write in progress
+
+                std::memcpy(&out, &value, sizeof(T));
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if (sequence.load(std::memory_order_relaxed) == before)
+                {
+                    if (version) *version = before;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // Read a consistent snapshot, spinning until the writer is done
+        T load(std::uint32_t* version = nullptr) const noexcept
+        {
+            T out;
+            while (!try_load(out, version))
+            {
+            }
+            return out;
+        }
+
+        // Even number that changes on every completed store
+        [[nodiscard]] std::uint32_t version() const noexcept
+        {
+            return sequence.load(std::memory_order_acquire) & ~1u;
+        }
+    };
+}
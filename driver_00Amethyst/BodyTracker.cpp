@@ -1,104 +1,87 @@
 #include <openvr_driver.h>
 #include "BodyTracker.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <ranges>
 
-BodyTracker::BodyTracker(const std::string& serial, const ITrackerType role) : _type(role)
+namespace
+{
+    // One-Euro parameters (position, rotation) per role: hands need the least lag,
+    // slow-moving body joints can take more smoothing
+    std::pair<OneEuroParams, OneEuroParams> filter_params(const ITrackerType role)
+    {
+        switch (role) // NOLINT(clang-diagnostic-switch-enum)
+        {
+        case Tracker_LeftHand:
+        case Tracker_RightHand:
+            return {{1.5, 1.0, 1.0}, {1.5, 0.5, 1.0}};
+        case Tracker_Waist:
+        case Tracker_Chest:
+            return {{0.5, 0.3, 1.0}, {0.5, 0.2, 1.0}};
+        default:
+            return {{1.0, 0.5, 1.0}, {1.0, 0.3, 1.0}};
+        }
+    }
+}
+
+BodyTracker::BodyTracker(const std::string& serial, const ITrackerType role) :
+    _filter(std::make_from_tuple<OneEuroPoseFilter>(filter_params(role))), _type(role)
 {
     _serial = serial;
     _role = static_cast<int>(role);
     _active = false;
 
-    _pose = {0};
-    _pose.poseIsValid = true; // Otherwise tracker may disappear
-    _pose.result = vr::TrackingResult_Running_OK;
-    _pose.deviceIsConnected = false;
+    vr::DriverPose_t pose = {0};
+    pose.poseIsValid = false; // Until the first pose is received
+    pose.result = vr::TrackingResult_Running_OK;
+    pose.deviceIsConnected = false;
 
-    // OpenVR Space Calibration : done on client side
-    _pose.qWorldFromDriverRotation.w = 1;
-    _pose.qWorldFromDriverRotation.x = 0;
-    _pose.qWorldFromDriverRotation.y = 0;
-    _pose.qWorldFromDriverRotation.z = 0;
+    // OpenVR Space Calibration : stamped on submission, see g_world_from_driver
+    pose.qWorldFromDriverRotation.w = 1;
+    pose.qWorldFromDriverRotation.x = 0;
+    pose.qWorldFromDriverRotation.y = 0;
+    pose.qWorldFromDriverRotation.z = 0;
 
     // OpenVR Driver Calibration : done on client side
-    _pose.qDriverFromHeadRotation.w = 1;
-    _pose.qDriverFromHeadRotation.x = 0;
-    _pose.qDriverFromHeadRotation.y = 0;
-    _pose.qDriverFromHeadRotation.z = 0;
+    pose.qDriverFromHeadRotation.w = 1;
+    pose.qDriverFromHeadRotation.x = 0;
+    pose.qDriverFromHeadRotation.y = 0;
+    pose.qDriverFromHeadRotation.z = 0;
 
     // Position
-    _pose.vecPosition[0] = 0;
-    _pose.vecPosition[1] = 0;
-    _pose.vecPosition[2] = 0;
+    pose.vecPosition[0] = 0;
+    pose.vecPosition[1] = 0;
+    pose.vecPosition[2] = 0;
 
     // Rotation
-    _pose.qRotation.w = 1;
-    _pose.qRotation.x = 0;
-    _pose.qRotation.y = 0;
-    _pose.qRotation.z = 0;
+    pose.qRotation.w = 1;
+    pose.qRotation.x = 0;
+    pose.qRotation.y = 0;
+    pose.qRotation.z = 0;
 
     // Velocity
-    _pose.vecVelocity[0] = 0;
-    _pose.vecVelocity[1] = 0;
-    _pose.vecVelocity[2] = 0;
+    pose.vecVelocity[0] = 0;
+    pose.vecVelocity[1] = 0;
+    pose.vecVelocity[2] = 0;
 
     // Acceleration
-    _pose.vecAcceleration[0] = 0;
-    _pose.vecAcceleration[1] = 0;
-    _pose.vecAcceleration[2] = 0;
+    pose.vecAcceleration[0] = 0;
+    pose.vecAcceleration[1] = 0;
+    pose.vecAcceleration[2] = 0;
 
     // Angular Velocity
-    _pose.vecAngularVelocity[0] = 0;
-    _pose.vecAngularVelocity[1] = 0;
-    _pose.vecAngularVelocity[2] = 0;
+    pose.vecAngularVelocity[0] = 0;
+    pose.vecAngularVelocity[1] = 0;
+    pose.vecAngularVelocity[2] = 0;
 
     // Angular Acceleration
-    _pose.vecAngularAcceleration[0] = 0;
-    _pose.vecAngularAcceleration[1] = 0;
-    _pose.vecAngularAcceleration[2] = 0;
+    pose.vecAngularAcceleration[0] = 0;
+    pose.vecAngularAcceleration[1] = 0;
+    pose.vecAngularAcceleration[2] = 0;
 
-    // Input components
-    if (role == Tracker_LeftHand)
-    {
-        boolean_components_ = {
-            {"/input/system/click", 0},
-            {"/input/x/click", 0},
-            {"/input/x/touch", 0},
-            {"/input/y/click", 0},
-            {"/input/y/touch", 0},
-            {"/input/trigger/touch", 0},
-            {"/input/grip/touch", 0},
-            {"/input/joystick/click", 0},
-            {"/input/joystick/touch", 0},
-        };
-
-        scalar_components_ = {
-            {"/input/grip/value", 0},
-            {"/input/trigger/value", 0},
-            {"/input/joystick/x", 1},
-            {"/input/joystick/y", 1}
-        };
-    }
-    else if (role == Tracker_RightHand)
-    {
-        boolean_components_ = {
-            {"/input/system/click", 0},
-            {"/input/a/click", 0},
-            {"/input/a/touch", 0},
-            {"/input/b/click", 0},
-            {"/input/b/touch", 0},
-            {"/input/trigger/touch", 0},
-            {"/input/grip/touch", 0},
-            {"/input/joystick/click", 0},
-            {"/input/joystick/touch", 0},
-        };
-
-        scalar_components_ = {
-            {"/input/grip/value", 0},
-            {"/input/trigger/value", 0},
-            {"/input/joystick/x", 1},
-            {"/input/joystick/y", 1}
-        };
-    }
+    // Publish the initial pose
+    _pose.store({pose, AME_API_GET_STEADY_TIMESTAMP_NOW});
 }
 
 std::string BodyTracker::get_serial() const
@@ -106,97 +89,204 @@ std::string BodyTracker::get_serial() const
     return _serial;
 }
 
-void BodyTracker::update()
+void BodyTracker::update(const WorldFromDriverTransform& world, const uint32_t world_version)
 {
+    // Apply the latest received sample, if any (also before activation, for GetPose)
+    if (dTrackerBase sample; _mailbox.take(sample))
+    {
+        _consumption_latency.record(AME_API_GET_STEADY_TIMESTAMP_NOW - sample.Timestamp);
+        apply_pose(sample);
+    }
+
     if (_index != vr::k_unTrackedDeviceIndexInvalid && _activated)
     {
+        // Grab a consistent snapshot, GetPose may be reading concurrently
+        uint32_t version;
+        const auto state = _pose.load(&version);
+        const auto now = AME_API_GET_STEADY_TIMESTAMP_NOW;
+        const bool active = _active;
+
+        // Interpolating between buffered samples: the output changes every frame
+        // until a submission lands past the newest sample
+        const auto delay = g_pose_interpolation_delay_us;
+        const auto interpolate = delay > 0 && state.pose.poseIsValid && !state.history.empty();
+        const auto moving = interpolate && _submission.submitted_at() - delay < state.history.newest().timestamp;
+
+        if (!_submission.should_submit(version, world_version, active, moving, now, g_pose_keep_alive_us))
+            return;
+
+        auto pose = state.pose;
+
         // If _active is false, then disconnect the tracker
-        _pose.poseIsValid = _valid;
-        _pose.deviceIsConnected = _active;
+        pose.deviceIsConnected = active;
+
+        // Let the runtime compose the playspace transform
+        pose.qWorldFromDriverRotation = world.rotation;
+        for (auto i = 0; i < 3; i++)
+            pose.vecWorldFromDriverTranslation[i] = world.translation[i];
 
-        vr::VRServerDriverHost()->TrackedDevicePoseUpdated(_index, _pose, sizeof _pose);
+        PoseHistorySample sample;
+        if (interpolate && state.history.sample(now - delay, sample))
+        {
+            // Trade a fixed delay for smooth motion between irregular samples
+            for (auto i = 0; i < 3; i++)
+            {
+                pose.vecPosition[i] = sample.position[i];
+                pose.vecVelocity[i] = sample.velocity[i];
+            }
+
+            pose.qRotation = sample.rotation;
+            pose.poseTimeOffset = 0.0; // Presented as current
+        }
+        else
+        {
+            // Let the runtime compensate for the time since capture
+            pose.poseTimeOffset = sample_time_offset(state.timestamp);
+        }
+
+        vr::VRServerDriverHost()->TrackedDevicePoseUpdated(_index, pose, sizeof pose);
     }
 }
 
-bool BodyTracker::set_pose(const dTrackerBase& tracker)
+void BodyTracker::set_pose(const dTrackerBase& tracker, const dPoseTransport transport)
+{
+    // Use the sender's capture time if provided (same steady clock), the arrival time otherwise
+    const auto now = AME_API_GET_STEADY_TIMESTAMP_NOW;
+    if (tracker.Timestamp > 0) _latency[transport].record(now - tracker.Timestamp);
+
+    auto sample = tracker;
+    sample.Serial = nullptr; // Owned by the caller
+    sample.Timestamp = tracker.Timestamp > 0 && tracker.Timestamp <= now ? tracker.Timestamp : now;
+
+    // Replace whatever RunFrame hasn't picked up yet
+    _mailbox.post(sample);
+}
+
+bool BodyTracker::apply_pose(const dTrackerBase& tracker)
 {
     try
     {
+        // Build the new pose aside and publish it at once
+        auto state = _pose.load();
+        auto& pose = state.pose;
+        const auto timestamp = tracker.Timestamp;
+
         // Position
-        _pose.vecPosition[0] = tracker.Position.X;
-        _pose.vecPosition[1] = tracker.Position.Y;
-        _pose.vecPosition[2] = tracker.Position.Z;
-        _valid = tracker.TrackingState;
+        pose.vecPosition[0] = tracker.Position.X;
+        pose.vecPosition[1] = tracker.Position.Y;
+        pose.vecPosition[2] = tracker.Position.Z;
+        pose.poseIsValid = tracker.TrackingState;
 
         // Rotation
-        _pose.qRotation.w = tracker.Orientation.W;
-        _pose.qRotation.x = tracker.Orientation.X;
-        _pose.qRotation.y = tracker.Orientation.Y;
-        _pose.qRotation.z = tracker.Orientation.Z;
+        pose.qRotation.w = tracker.Orientation.W;
+        pose.qRotation.x = tracker.Orientation.X;
+        pose.qRotation.y = tracker.Orientation.Y;
+        pose.qRotation.z = tracker.Orientation.Z;
+
+        // Optional in-driver smoothing, restarted after tracking loss
+        if (g_pose_filter_enabled && tracker.TrackingState)
+        {
+            PoseFilterSample sample{
+                {pose.vecPosition[0], pose.vecPosition[1], pose.vecPosition[2]},
+                pose.qRotation, static_cast<double>(timestamp) / 1e6
+            };
+
+            _filter.apply(sample);
+            for (auto i = 0; i < 3; i++)
+                pose.vecPosition[i] = sample.position[i];
+            pose.qRotation = sample.rotation;
+        }
+        else _filter.reset();
+
+        // Estimate derivatives from the pose history, used if the sender doesn't define them
+        double estimated_velocity[3], estimated_angular_velocity[3];
+        if (tracker.TrackingState)
+            _estimator.update(pose.vecPosition, pose.qRotation, static_cast<double>(timestamp) / 1e6,
+                              estimated_velocity, estimated_angular_velocity);
+        else
+        {
+            _estimator.reset(); // Don't differentiate across tracking loss
+            for (auto i = 0; i < 3; i++)
+                estimated_velocity[i] = estimated_angular_velocity[i] = 0.;
+        }
 
         // If the sender defines its own velocity
         if (tracker.Velocity.HasValue)
         {
             // Velocity
-            _pose.vecVelocity[0] = tracker.Velocity.Value.X;
-            _pose.vecVelocity[1] = tracker.Velocity.Value.Y;
-            _pose.vecVelocity[2] = tracker.Velocity.Value.Z;
+            pose.vecVelocity[0] = tracker.Velocity.Value.X;
+            pose.vecVelocity[1] = tracker.Velocity.Value.Y;
+            pose.vecVelocity[2] = tracker.Velocity.Value.Z;
         }
         else
         {
-            // Velocity
-            _pose.vecVelocity[0] = 0.;
-            _pose.vecVelocity[1] = 0.;
-            _pose.vecVelocity[2] = 0.;
+            // Velocity (estimated)
+            pose.vecVelocity[0] = estimated_velocity[0];
+            pose.vecVelocity[1] = estimated_velocity[1];
+            pose.vecVelocity[2] = estimated_velocity[2];
         }
 
         // If the sender defines its own acceleration
         if (tracker.Acceleration.HasValue)
         {
             // Acceleration
-            _pose.vecAcceleration[0] = tracker.Acceleration.Value.X;
-            _pose.vecAcceleration[1] = tracker.Acceleration.Value.Y;
-            _pose.vecAcceleration[2] = tracker.Acceleration.Value.Z;
+            pose.vecAcceleration[0] = tracker.Acceleration.Value.X;
+            pose.vecAcceleration[1] = tracker.Acceleration.Value.Y;
+            pose.vecAcceleration[2] = tracker.Acceleration.Value.Z;
         }
         else
         {
             // Acceleration
-            _pose.vecAcceleration[0] = 0.;
-            _pose.vecAcceleration[1] = 0.;
-            _pose.vecAcceleration[2] = 0.;
+            pose.vecAcceleration[0] = 0.;
+            pose.vecAcceleration[1] = 0.;
+            pose.vecAcceleration[2] = 0.;
         }
 
         // If the sender defines its own ang velocity
         if (tracker.AngularVelocity.HasValue)
         {
             // Angular Velocity
-            _pose.vecAngularVelocity[0] = tracker.AngularVelocity.Value.X;
-            _pose.vecAngularVelocity[1] = tracker.AngularVelocity.Value.Y;
-            _pose.vecAngularVelocity[2] = tracker.AngularVelocity.Value.Z;
+            pose.vecAngularVelocity[0] = tracker.AngularVelocity.Value.X;
+            pose.vecAngularVelocity[1] = tracker.AngularVelocity.Value.Y;
+            pose.vecAngularVelocity[2] = tracker.AngularVelocity.Value.Z;
         }
         else
         {
-            // Angular Velocity
-            _pose.vecAngularVelocity[0] = 0.;
-            _pose.vecAngularVelocity[1] = 0.;
-            _pose.vecAngularVelocity[2] = 0.;
+            // Angular Velocity (estimated)
+            pose.vecAngularVelocity[0] = estimated_angular_velocity[0];
+            pose.vecAngularVelocity[1] = estimated_angular_velocity[1];
+            pose.vecAngularVelocity[2] = estimated_angular_velocity[2];
         }
 
         // If the sender defines its own ang acceleration
         if (tracker.AngularAcceleration.HasValue)
         {
             // Angular Acceleration
-            _pose.vecAngularAcceleration[0] = tracker.AngularAcceleration.Value.X;
-            _pose.vecAngularAcceleration[1] = tracker.AngularAcceleration.Value.Y;
-            _pose.vecAngularAcceleration[2] = tracker.AngularAcceleration.Value.Z;
+            pose.vecAngularAcceleration[0] = tracker.AngularAcceleration.Value.X;
+            pose.vecAngularAcceleration[1] = tracker.AngularAcceleration.Value.Y;
+            pose.vecAngularAcceleration[2] = tracker.AngularAcceleration.Value.Z;
         }
         else
         {
             // Angular Acceleration
-            _pose.vecAngularAcceleration[0] = 0.;
-            _pose.vecAngularAcceleration[1] = 0.;
-            _pose.vecAngularAcceleration[2] = 0.;
+            pose.vecAngularAcceleration[0] = 0.;
+            pose.vecAngularAcceleration[1] = 0.;
+            pose.vecAngularAcceleration[2] = 0.;
         }
+
+        // Buffer tracked samples for interpolation, restart after tracking loss
+        if (tracker.TrackingState)
+            state.history.push({
+                .position = {pose.vecPosition[0], pose.vecPosition[1], pose.vecPosition[2]},
+                .rotation = pose.qRotation,
+                .velocity = {pose.vecVelocity[0], pose.vecVelocity[1], pose.vecVelocity[2]},
+                .has_velocity = static_cast<bool>(tracker.Velocity.HasValue),
+                .timestamp = timestamp
+            });
+        else state.history.clear();
+
+        state.timestamp = timestamp;
+        _pose.store(state);
     }
     catch (...)
     {
@@ -212,30 +302,119 @@ void BodyTracker::set_state(const bool state)
     _active = state;
 }
 
+uint32_t BodyTracker::resolve_input(const std::string& path) const
+{
+    // Well-known actions of this hand
+    if (const auto action = find_input_action(path); action >= 0)
+        return is_hand() && k_input_actions[action].hand == input_hand()
+                   ? static_cast<uint32_t>(action)
+                   : k_invalid_input_token;
+
+    // Raw component paths, placed after the actions
+    if (const auto component = find_input_component(path);
+        component >= 0 && has_input_component(static_cast<InputComponent>(component)))
+        return static_cast<uint32_t>(k_input_actions.size() + component);
+
+    return k_invalid_input_token;
+}
+
 bool BodyTracker::update_input(const std::string& path, const bool& value)
 {
-    // If the path is a well-known type of input action
-    if (_type == Tracker_LeftHand && input_paths_map_left_.contains(path))
-        return input_paths_map_left_[path].invoke(value);
-    if (_type == Tracker_RightHand && input_paths_map_right_.contains(path))
-        return input_paths_map_right_[path].invoke(value);
-
-    if (!boolean_components_.contains(path) || boolean_components_[path] <= 0) return false;
-    return vr::VRDriverInput()->UpdateBooleanComponent(
-        boolean_components_[path], value, 0) == vr::VRInputError_None;
+    return update_input(resolve_input(path), value);
 }
 
 bool BodyTracker::update_input(const std::string& path, const float& value)
 {
-    // If the path is a well-known type of input action
-    if (_type == Tracker_LeftHand && input_paths_map_left_.contains(path))
-        return input_paths_map_left_[path].invoke(value);
-    if (_type == Tracker_RightHand && input_paths_map_right_.contains(path))
-        return input_paths_map_right_[path].invoke(value);
-
-    if (!scalar_components_.contains(path) || scalar_components_[path] <= 0) return false;
-    return vr::VRDriverInput()->UpdateScalarComponent(
-        scalar_components_[path], value, 0) == vr::VRInputError_None;
+    return update_input(resolve_input(path), value);
+}
+
+bool BodyTracker::update_input(const uint32_t token, const bool& value, const double time_offset) const
+{
+    // Every handling mode maps true/false the same as 1.0/0.0
+    return update_input(token, value ? 1.0f : 0.0f, time_offset);
+}
+
+bool BodyTracker::update_input(const uint32_t token, const float& value, const double time_offset) const
+{
+    // Well-known action: update all of its bound components
+    if (token < k_input_actions.size())
+    {
+        const auto& action = k_input_actions[token];
+        if (!is_hand() || action.hand != input_hand()) return false;
+
+        auto result_value = true;
+        for (std::uint8_t i = 0; i < action.binding_count; i++)
+            result_value &= update_component(action.bindings[i].component,
+                                             action.bindings[i].mode, value, time_offset);
+
+        return result_value;
+    }
+
+    // Raw component
+    if (token < k_input_actions.size() + Input_ComponentCount)
+    {
+        const auto component = static_cast<InputComponent>(token - k_input_actions.size());
+        return update_component(component, k_input_components[component].scalar ? ModeScalar : ModeBoolean,
+                                value, time_offset);
+    }
+
+    return false;
+}
+
+bool BodyTracker::update_skeleton(const dSkeletonPose& skeleton) const
+{
+    if (skeleton_handle_ == vr::k_ulInvalidInputComponentHandle) return false;
+
+    // Unpack the bones: float positions, 16-bit normalized orientations
+    vr::VRBoneTransform_t bones[k_skeleton_bone_count];
+    for (std::uint32_t i = 0; i < k_skeleton_bone_count; i++)
+    {
+        bones[i].position = {
+            skeleton.Positions[i * 3], skeleton.Positions[i * 3 + 1], skeleton.Positions[i * 3 + 2], 1.f
+        };
+
+        const auto* const q = &skeleton.Orientations[i * 4];
+        const auto x = q[0] / 32767.f, y = q[1] / 32767.f, z = q[2] / 32767.f, w = q[3] / 32767.f;
+
+        // Renormalize after quantization, fall back to identity if empty
+        const auto norm = std::sqrt(x * x + y * y + z * z + w * w);
+        bones[i].orientation = norm > 1e-6f
+                                   ? vr::HmdQuaternionf_t{w / norm, x / norm, y / norm, z / norm}
+                                   : vr::HmdQuaternionf_t{1.f, 0.f, 0.f, 0.f};
+    }
+
+    // There's no separate controller-less pose, use the same one for both ranges
+    const auto with_controller = vr::VRDriverInput()->UpdateSkeletonComponent(
+        skeleton_handle_, vr::VRSkeletalMotionRange_WithController, bones, k_skeleton_bone_count);
+    const auto without_controller = vr::VRDriverInput()->UpdateSkeletonComponent(
+        skeleton_handle_, vr::VRSkeletalMotionRange_WithoutController, bones, k_skeleton_bone_count);
+
+    return with_controller == vr::VRInputError_None && without_controller == vr::VRInputError_None;
+}
+
+bool BodyTracker::has_input_component(const InputComponent component) const
+{
+    return is_hand() && (k_input_components[component].hand == InputHand_Both ||
+        k_input_components[component].hand == input_hand());
+}
+
+bool BodyTracker::update_component(const InputComponent component, const InputActionHandlingMode mode,
+                                   const float value, const double time_offset) const
+{
+    const auto handle = input_handles_[component];
+    if (handle == vr::k_ulInvalidInputComponentHandle) return false;
+
+    switch (mode)
+    {
+    case ModeBoolean:
+        return vr::VRDriverInput()->UpdateBooleanComponent(handle, value >= 0.5f, time_offset) == vr::VRInputError_None;
+    case ModeScalar:
+        return vr::VRDriverInput()->UpdateScalarComponent(handle, value, time_offset) == vr::VRInputError_None;
+    case ModeHasValue:
+        return vr::VRDriverInput()->UpdateBooleanComponent(handle, value != 0.0f, time_offset) == vr::VRInputError_None;
+    default:
+        return false;
+    }
 }
 
 bool BodyTracker::spawn()
@@ -266,14 +445,29 @@ ITrackerType BodyTracker::get_role() const
     return static_cast<ITrackerType>(_role);
 }
 
-void BodyTracker::process_event(const vr::VREvent_t& event)
+bool BodyTracker::process_event(const vr::VREvent_t& event, dHapticEvent& haptic) const
 {
+    if (event.eventType != vr::VREvent_Input_HapticVibration ||
+        haptic_handle_ == vr::k_ulInvalidInputComponentHandle ||
+        event.data.hapticVibration.componentHandle != haptic_handle_)
+        return false;
+
+    haptic = {
+        .Tracker = static_cast<dTrackerType>(_role),
+        .Duration = event.data.hapticVibration.fDurationSeconds,
+        .Frequency = event.data.hapticVibration.fFrequency,
+        .Amplitude = event.data.hapticVibration.fAmplitude,
+        .Timestamp = AME_API_GET_STEADY_TIMESTAMP_NOW - static_cast<long long>(event.eventAgeSeconds * 1e6)
+    };
+
+    return true;
 }
 
 vr::EVRInitError BodyTracker::Activate(vr::TrackedDeviceIndex_t index)
 {
     // Save the device index
     _index = index;
+    _submission.reset(); // Submit the first pose right away
 
     // Get the properties handle for our controller
     _props = vr::VRProperties()->TrackedDeviceToPropertyContainer(_index);
@@ -281,17 +475,25 @@ vr::EVRInitError BodyTracker::Activate(vr::TrackedDeviceIndex_t index)
     // Set our universe ID
     vr::VRProperties()->SetUint64Property(_props, vr::Prop_CurrentUniverseId_Uint64, 2);
 
-    // Create a haptic component
-    uint64_t handle_temp = 0;
-    vr::VRDriverInput()->CreateHapticComponent(_props, "/output/haptic", &handle_temp);
+    // Create a haptic component (requests are forwarded through PollHapticEvents)
+    vr::VRDriverInput()->CreateHapticComponent(_props, "/output/haptic", &haptic_handle_);
+
+    // Create other components (hands only)
+    for (std::size_t i = 0; i < Input_ComponentCount; i++)
+    {
+        if (!has_input_component(static_cast<InputComponent>(i))) continue;
+        if (const auto& [path, hand, scalar, units] = k_input_components[i]; scalar)
+            vr::VRDriverInput()->CreateScalarComponent(_props, path.data(), &input_handles_[i],
+                                                       vr::EVRScalarType::VRScalarType_Absolute, units);
+        else vr::VRDriverInput()->CreateBooleanComponent(_props, path.data(), &input_handles_[i]);
+    }
 
-    // Create other components
-    for (auto& [component, handle] : boolean_components_)
-        vr::VRDriverInput()->CreateBooleanComponent(_props, component.c_str(), &handle);
-    for (auto& [component, handle] : scalar_components_)
-        vr::VRDriverInput()->CreateScalarComponent(_props, component.c_str(), &handle,
-                                                   vr::EVRScalarType::VRScalarType_Absolute,
-                                                   static_cast<vr::EVRScalarUnits>(handle));
+    // Hand skeleton, fed by UpdateSkeleton
+    if (is_hand())
+        vr::VRDriverInput()->CreateSkeletonComponent(
+            _props, input_hand() == InputHand_Left ? "/input/skeleton/left" : "/input/skeleton/right",
+            input_hand() == InputHand_Left ? "/skeleton/hand/left" : "/skeleton/hand/right",
+            "/pose/raw", vr::VRSkeletalTracking_Partial, nullptr, 0, &skeleton_handle_);
 
     // Register all properties
     vr::VRProperties()->SetStringProperty(_props, vr::Prop_TrackingSystemName_String, "amethyst");
@@ -393,13 +595,6 @@ vr::EVRInitError BodyTracker::Activate(vr::TrackedDeviceIndex_t index)
         vr::VRProperties()->SetStringProperty(_props, vr::Prop_NamedIconPathDeviceAlertLow_String,
                                               std::format("{{oculus}}/icons/rifts_{}_controller_ready_low.png",
                                                           _type == Tracker_LeftHand ? "left" : "right").c_str());
-
-        // Propagate input components to controller actions
-        for (auto& action_set : input_paths_map_left_ | std::views::values)
-            action_set.update_components(boolean_components_, scalar_components_);
-
-        for (auto& action_set : input_paths_map_right_ | std::views::values)
-            action_set.update_components(boolean_components_, scalar_components_);
     }
     else
     {
@@ -457,5 +652,13 @@ vr::EVRInitError BodyTracker::Activate(vr::TrackedDeviceIndex_t index)
 
 vr::DriverPose_t BodyTracker::GetPose()
 {
-    return _pose;
+    auto pose = _pose.load().pose;
+    pose.deviceIsConnected = _active;
+
+    const auto world = g_world_from_driver.load();
+    pose.qWorldFromDriverRotation = world.rotation;
+    for (auto i = 0; i < 3; i++)
+        pose.vecWorldFromDriverTranslation[i] = world.translation[i];
+
+    return pose;
 }
@@ -1,15 +1,57 @@
 // ReSharper disable CppClangTidyClangDiagnosticSwitchEnum
 #pragma once
+#include <algorithm>
+#include <chrono>
 #include <filesystem>
 #include <map>
 #include <openvr_driver.h>
 
 #include "DataContract.h"
+#include "InputActions.h"
+#include "LatencyHistogram.h"
+#include "PoseEstimator.h"
+#include "PoseFilter.h"
+#include "PoseHistory.h"
+#include "PoseSubmission.h"
+#include "util/latest_mailbox.hpp"
+#include "util/seqlock.hpp"
+#include "WorldFromDriver.h"
 
 #define AME_API_GET_TIMESTAMP_NOW \
 	std::chrono::time_point_cast<std::chrono::microseconds>	\
 	(std::chrono::system_clock::now()).time_since_epoch().count()
 
+// Same as above, but on the monotonic (QPC) clock shared with the client
+#define AME_API_GET_STEADY_TIMESTAMP_NOW \
+	std::chrono::time_point_cast<std::chrono::microseconds>	\
+	(std::chrono::steady_clock::now()).time_since_epoch().count()
+
+// Number of dPoseTransport values
+inline constexpr std::size_t k_pose_transport_count = PoseTransport_Channel + 1;
+
+// Poses older than this aren't extrapolated any further
+inline constexpr long long k_max_pose_age_us = 100000;
+
+// OpenVR time offset (seconds, <= 0) of a steady clock sample, 0 if unknown
+inline double sample_time_offset(const long long timestamp)
+{
+    if (timestamp <= 0) return 0.0;
+    const auto age = std::clamp(AME_API_GET_STEADY_TIMESTAMP_NOW - timestamp, 0ll, k_max_pose_age_us);
+    return -static_cast<double>(age) / 1e6;
+}
+
+// Unchanged poses are resubmitted at least this often (set from vrsettings on Init)
+inline long long g_pose_keep_alive_us = 50000;
+
+// Poses are rendered this far in the past, interpolated between samples (0 = latest sample as is)
+inline long long g_pose_interpolation_delay_us = 0;
+
+// Filter incoming poses in the driver (per-role One-Euro parameters, see BodyTracker.cpp)
+inline bool g_pose_filter_enabled = false;
+
+// Filter stages applied to every tracked sample when enabled
+using TrackerPoseFilter = PoseFilterChain<OneEuroPoseFilter>;
+
 // Is HMD pose override enabled atm
 inline bool m_is_head_override_active = false;
 
@@ -89,106 +131,16 @@ const std::map<ITrackerType, const char*>
         {Tracker_RightHand, "AME-RHAND"}
     };
 
-enum InputActionHandlingMode : std::uint8_t
+// Published tracker state: the pose and the time it was captured at
+struct TrackerPoseState
 {
-    ModeInvalid,
-    ModeScalar, // Move true=1.0, false=0.0
-    ModeBoolean, // Move to bool as >=0.5f
-    ModeHasValue // True if .first is not 0
+    vr::DriverPose_t pose;
+    long long timestamp; // Steady clock microseconds
+    PoseHistory history; // Recent tracked samples, for interpolation
 };
 
-struct DataInputAction
-{
-    std::string path;
-    InputActionHandlingMode mode = ModeInvalid;
-};
-
-class InputActionSet
-{
-public:
-    InputActionSet() = default;
-
-    explicit InputActionSet(const std::initializer_list<DataInputAction>& m_actions) : actions(m_actions)
-    {
-    }
-
-    std::vector<DataInputAction> actions;
-    std::map<std::string, vr::VRInputComponentHandle_t> boolean_components;
-    std::map<std::string, vr::VRInputComponentHandle_t> scalar_components;
-
-    void update_components(
-        const std::map<std::string, vr::VRInputComponentHandle_t>& m_boolean_components,
-        const std::map<std::string, vr::VRInputComponentHandle_t>& m_scalar_components)
-    {
-        boolean_components = m_boolean_components;
-        scalar_components = m_scalar_components;
-    }
-
-    bool invoke(const bool& value)
-    {
-        if (actions.empty()) return false;
-        auto result_value = false;
-
-        for (const auto& [path, mode] : actions)
-        {
-            switch (mode)
-            {
-            case ModeBoolean:
-                result_value &= update_boolean(path, value);
-                break;
-            case ModeScalar:
-                result_value &= update_scalar(path, value ? 1.0f : 0.0f);
-                break;
-            case ModeHasValue:
-                result_value &= update_boolean(path, value);
-                break;
-            default: break;
-            }
-        }
-
-        return result_value;
-    }
-
-    bool invoke(const float& value)
-    {
-        if (actions.empty()) return false;
-        auto result_value = false;
-
-        for (const auto& [path, mode] : actions)
-        {
-            switch (mode)
-            {
-            case ModeBoolean:
-                result_value &= update_boolean(path, value >= 0.5f);
-                break;
-            case ModeScalar:
-                result_value &= update_scalar(path, value);
-                break;
-            case ModeHasValue:
-                result_value &= update_boolean(path, value > 0.0f);
-                break;
-            default: break;
-            }
-        }
-
-        return result_value;
-    }
-
-private:
-    bool update_boolean(const std::string& path, const bool& value)
-    {
-        if (path.empty() || !boolean_components.contains(path)) return false;
-        return vr::VRDriverInput()->UpdateBooleanComponent(
-            boolean_components[path], value, 0) == vr::VRInputError_None;
-    }
-
-    bool update_scalar(const std::string& path, const float& value)
-    {
-        if (path.empty() || !scalar_components.contains(path)) return false;
-        return vr::VRDriverInput()->UpdateScalarComponent(
-            scalar_components[path], value, 0) == vr::VRInputError_None;
-    }
-};
+// Returned by BodyTracker::resolve_input for unknown paths
+inline constexpr uint32_t k_invalid_input_token = 0xFFFFFFFF;
 
 class BodyTracker : public vr::ITrackedDeviceServerDriver
 {
@@ -215,14 +167,16 @@ public:
     [[nodiscard]] ITrackerType get_role() const;
 
     /**
-     * \brief Update void for server driver
+     * \brief Update void for server driver, skipped if nothing changed (see g_pose_keep_alive_us)
+     * \param world Playspace transform of this frame, resubmitted when world_version changes
      */
-    void update();
+    void update(const WorldFromDriverTransform& world, uint32_t world_version);
 
     /**
-     * \brief Function processing OpenVR events
+     * \brief Check if an OpenVR event is a haptic request for this device
+     * \return true (and the request in haptic) if it is
      */
-    static void process_event(const vr::VREvent_t& event);
+    bool process_event(const vr::VREvent_t& event, dHapticEvent& haptic) const;
 
     /**
      * \brief Activate device (called from OpenVR)
@@ -273,8 +227,8 @@ public:
      */
     vr::DriverPose_t GetPose() override;
 
-    // Update pose
-    bool set_pose(const dTrackerBase& tracker);
+    // Queue a pose for the next frame, replacing any pending one (never blocks)
+    void set_pose(const dTrackerBase& tracker, dPoseTransport transport = PoseTransport_Com);
 
     void set_state(bool state);
     bool spawn(); // TrackedDeviceAdded
@@ -282,23 +236,66 @@ public:
     bool update_input(const std::string& path, const bool& value);
     bool update_input(const std::string& path, const float& value);
 
+    /**
+     * \brief Resolve an input action GUID or component path to a token
+     * \return Index into k_input_actions (then components), k_invalid_input_token if unknown
+     */
+    [[nodiscard]] uint32_t resolve_input(const std::string& path) const;
+
+    // Pre-resolved variants: O(1), no string handling, time_offset as in OpenVR (seconds, <= 0)
+    bool update_input(uint32_t token, const bool& value, double time_offset = 0.0) const;
+    bool update_input(uint32_t token, const float& value, double time_offset = 0.0) const;
+
+    /**
+     * \brief Apply a hand skeleton (hands only), used for both motion ranges
+     * \return false if the tracker isn't a hand or isn't activated yet
+     */
+    bool update_skeleton(const dSkeletonPose& skeleton) const;
+
     // Get to know if tracker is activated (added)
     [[nodiscard]] bool is_added() const { return _added; }
     // Get to know if tracker is active (connected)
     [[nodiscard]] bool is_active() const { return _active; }
+    // Sample-to-driver latency of poses received through the given transport
+    [[nodiscard]] const LatencyHistogram& latency(const dPoseTransport transport) const
+    {
+        return _latency[transport];
+    }
+    // Sample-to-frame latency: until RunFrame applied the pose
+    [[nodiscard]] const LatencyHistogram& consumption_latency() const { return _consumption_latency; }
+    // Received poses replaced by a newer one before a frame picked them up
+    [[nodiscard]] uint64_t overwritten_samples() const { return _mailbox.overwritten(); }
     // Get to know if tracker is a hand tracker (controller)
     [[nodiscard]] bool is_hand() const { return _type == Tracker_LeftHand || _type == Tracker_RightHand; }
 
 private:
     // Is tracker added/active
-    bool _added = false, _active = false, _valid = false;
+    bool _added = false, _active = false;
     bool _activated = false;
 
     // Stores the openvr supplied device index.
     vr::TrackedDeviceIndex_t _index;
 
-    // Stores the devices current pose.
-    vr::DriverPose_t _pose;
+    // Latest received sample (written by set_pose from any thread, taken by update)
+    Util::latest_mailbox<dTrackerBase> _mailbox;
+
+    // Stores the devices current pose (written by update, read by update/GetPose)
+    Util::seqlock<TrackerPoseState> _pose;
+
+    // What update() last submitted (RunFrame thread only)
+    PoseSubmission _submission;
+
+    // Sample-to-driver latency per dPoseTransport, fed from capture timestamps
+    LatencyHistogram _latency[k_pose_transport_count];
+
+    // Sample (or arrival, without a capture timestamp) to the frame that applied it
+    LatencyHistogram _consumption_latency;
+
+    // Derives velocities when the sender doesn't provide them
+    PoseEstimator _estimator;
+
+    // Optional smoothing, see g_pose_filter_enabled
+    TrackerPoseFilter _filter;
 
     // An identifier for OpenVR for when we want to make property changes to this device.
     vr::PropertyContainerHandle_t _props;
@@ -308,166 +305,17 @@ private:
 
     ITrackerType _type;
 
-    std::map<std::string, vr::VRInputComponentHandle_t> boolean_components_;
-    std::map<std::string, vr::VRInputComponentHandle_t> scalar_components_;
-
-    std::map<std::string, InputActionSet> input_paths_map_left_{
-        {
-            "1A3ABE96-B1B3-4ABF-9969-C87BB15B2C13", InputActionSet{
-                DataInputAction{
-                    .path = "/input/system/click",
-                    .mode = ModeBoolean
-                }
-            }
-        },
-        {
-            "54B78337-23B6-4E36-A9C8-047061FB9256", InputActionSet{
-                DataInputAction{
-                    .path = "/input/trigger/value",
-                    .mode = ModeScalar
-                },
-                DataInputAction{
-                    .path = "/input/trigger/touch",
-                    .mode = ModeBoolean
-                }
-            }
-        },
-        {
-            "36DE93FB-01DD-4DEC-ACE6-E9ADD96027B7", InputActionSet{
-                DataInputAction{
-                    .path = "/input/grip/value",
-                    .mode = ModeScalar
-                },
-                DataInputAction{
-                    .path = "/input/grip/touch",
-                    .mode = ModeBoolean
-                }
-            }
-        },
-        {
-            "DAE6AD34-B3E4-46D0-AFEE-1CACFB1387A1", InputActionSet{
-                DataInputAction{
-                    .path = "/input/x/click",
-                    .mode = ModeBoolean
-                },
-                DataInputAction{
-                    .path = "/input/x/touch",
-                    .mode = ModeBoolean
-                }
-            }
-        },
-        {
-            "130B197B-EFC9-4A3A-9D3F-91A35BB83291", InputActionSet{
-                DataInputAction{
-                    .path = "/input/y/click",
-                    .mode = ModeBoolean
-                },
-                DataInputAction{
-                    .path = "/input/y/touch",
-                    .mode = ModeBoolean
-                }
-            }
-        },
-        {
-            "5F519116-9A5C-48BA-9693-D9A3741AF0AB", InputActionSet{
-                DataInputAction{
-                    .path = "/input/joystick/x",
-                    .mode = ModeBoolean
-                },
-                DataInputAction{
-                    .path = "/input/joystick/touch",
-                    .mode = ModeHasValue
-                }
-            }
-        },
-        {
-            "FF80F249-7F8D-4FA1-AC88-B9A1F5D623CB", InputActionSet{
-                DataInputAction{
-                    .path = "/input/joystick/y",
-                    .mode = ModeBoolean
-                },
-                DataInputAction{
-                    .path = "/input/joystick/touch",
-                    .mode = ModeHasValue
-                }
-            }
-        },
-    };
+    // Input component handles, only created for hand trackers (invalid otherwise)
+    std::array<vr::VRInputComponentHandle_t, Input_ComponentCount> input_handles_{};
+    vr::VRInputComponentHandle_t skeleton_handle_ = vr::k_ulInvalidInputComponentHandle;
+    vr::VRInputComponentHandle_t haptic_handle_ = vr::k_ulInvalidInputComponentHandle;
 
-    std::map<std::string, InputActionSet> input_paths_map_right_{
-        {
-            "6169CB90-4997-4266-AC33-83FF3FEF16AA", InputActionSet{
-                DataInputAction{
-                    .path = "/input/system/click",
-                    .mode = ModeBoolean
-                }
-            }
-        },
-        {
-            "CC84BF86-6846-4A7D-9111-7919F22D0FA7", InputActionSet{
-                DataInputAction{
-                    .path = "/input/trigger/value",
-                    .mode = ModeScalar
-                },
-                DataInputAction{
-                    .path = "/input/trigger/touch",
-                    .mode = ModeBoolean
-                }
-            }
-        },
-        {
-            "65EAFD83-C5D6-496F-BA3C-7FB0F9FED824", InputActionSet{
-                DataInputAction{
-                    .path = "/input/grip/value",
-                    .mode = ModeScalar
-                },
-                DataInputAction{
-                    .path = "/input/grip/touch",
-                    .mode = ModeBoolean
-                }
-            }
-        },
-        {
-            "98279522-D951-4EAC-9705-71EB5A9151D0", InputActionSet{
-                DataInputAction{
-                    .path = "/input/a/click",
-                    .mode = ModeBoolean
-                },
-                DataInputAction{
-                    .path = "/input/a/touch",
-                    .mode = ModeBoolean
-                }
-            }
-        },
-        {
-            "1D7238C7-3391-44BA-B40F-5F33AEE64114", InputActionSet{
-                DataInputAction{.path = "/input/b/click"},
-                DataInputAction{.path = "/input/b/touch"}
-            }
-        },
-        {
-            "46CD8C05-16F6-42D5-9265-133E57E0933B", InputActionSet{
-                DataInputAction{
-                    .path = "/input/joystick/x",
-                    .mode = ModeBoolean
-                },
-                DataInputAction{
-                    .path = "/input/joystick/touch",
-                    .mode = ModeHasValue
-                }
-            }
-        },
-        {
-            "14E62950-A538-422E-B688-82CCB5B1E179", InputActionSet{
-                DataInputAction{
-                    .path = "/input/joystick/y",
-                    .mode = ModeBoolean
-                },
-                DataInputAction{
-                    .path = "/input/joystick/touch",
-                    .mode = ModeHasValue
-                }
-            }
-        },
-    };
+    [[nodiscard]] InputHand input_hand() const { return _type == Tracker_LeftHand ? InputHand_Left : InputHand_Right; }
+    [[nodiscard]] bool has_input_component(InputComponent component) const;
+
+    bool update_component(InputComponent component, InputActionHandlingMode mode,
+                          float value, double time_offset) const;
+
+    // Filter, estimate and publish a received sample (RunFrame thread only)
+    bool apply_pose(const dTrackerBase& tracker);
 };
@@ -1,11 +1,14 @@
 #include "DriverService.h"
 
+#include <cmath>
 #include <ranges>
 #include <RpcProxy.h>
 #include <shellapi.h>
 
 #include "constants.hpp"
 #include "Logging.h"
+#include "PoseSample.h"
+#include "QuantizedPose.h"
 #include "util/color.hpp"
 
 DWORD DriverService::proxy_stub_registration_cookie_ = 0;
@@ -39,23 +42,21 @@ HRESULT DriverService::SetTrackerState(dTrackerBase tracker)
         // Check the state and attempts spawning the tracker
         if (!p_tracker->is_added() && !p_tracker->spawn())
         {
-            logMessage(std::format("Couldn't spawn tracker  ID {} due to an unknown native exception.",
-                                   static_cast<int>(tracker.Role)));
+            logFormat("Couldn't spawn tracker  ID {} due to an unknown native exception.",
+                      static_cast<int>(tracker.Role));
             return E_FAIL; // Failure
         }
 
-        // Set the state of the native tracker
+        // Set the state of the native tracker, RunFrame submits it on the next frame
         p_tracker->set_state(tracker.ConnectionState);
-        logMessage(std::format("Tracker ID {} state set to {}.",
-                               static_cast<int>(tracker.Role), tracker.ConnectionState == 1));
+        logFormat("Tracker ID {} state set to {}.",
+                  static_cast<int>(tracker.Role), tracker.ConnectionState == 1);
 
-        // Call the VR update handler and compose the result
-        tracker_vector_->at(static_cast<ITrackerType>(tracker.Role)).update();
         return S_OK;
     }
 
-    logMessage(std::format("Couldn't spawn tracker ID {}. The tracker index was out of bounds.",
-                           static_cast<int>(tracker.Role)));
+    logFormat("Couldn't spawn tracker ID {}. The tracker index was out of bounds.",
+              static_cast<int>(tracker.Role));
 
     return ERROR_INVALID_INDEX; // Failure
 }
@@ -67,35 +68,59 @@ HRESULT DriverService::UpdateTracker(dTrackerBase tracker)
     // HMD pose override
     if (tracker.Role == TrackerHead)
     {
-        return SetDriverPose(0, dDriverPose{
-                                 .ConnectionState = true,
-                                 .TrackingState = true,
-                                 .Position = tracker.Position,
-                                 .Orientation = tracker.Orientation
-                             });
+        const auto result = SetDriverPose(0, dDriverPose{
+                                              .ConnectionState = true,
+                                              .TrackingState = true,
+                                              .Position = tracker.Position,
+                                              .Orientation = tracker.Orientation
+                                          });
+
+        (result == S_OK ? poses_received_ : poses_rejected_).fetch_add(1, std::memory_order_relaxed);
+        return result;
     }
 
     // Normal case
     if (tracker_vector_->contains(static_cast<ITrackerType>(tracker.Role)))
     {
-        // Update the pose of the passed tracker
-        if (!tracker_vector_->at(static_cast<ITrackerType>(tracker.Role)).set_pose(tracker))
-        {
-            logMessage(std::format("Couldn't spawn tracker ID {} due to an unknown native exception.",
-                                   static_cast<int>(tracker.Role)));
-            return E_FAIL; // Failure
-        }
-
-        // Call the VR update handler and compose the result
+        // Queue the pose of the passed tracker, picked up on the next frame
+        tracker_vector_->at(static_cast<ITrackerType>(tracker.Role)).set_pose(tracker);
+        poses_received_.fetch_add(1, std::memory_order_relaxed);
         return S_OK;
     }
 
-    logMessage(std::format("Couldn't spawn tracker ID {}. The tracker index was out of bounds.",
-                           static_cast<int>(tracker.Role)));
+    poses_rejected_.fetch_add(1, std::memory_order_relaxed);
+    logFormat("Couldn't spawn tracker ID {}. The tracker index was out of bounds.",
+              static_cast<int>(tracker.Role));
 
     return ERROR_INVALID_INDEX; // Failure
 }
 
+HRESULT DriverService::SetTrackerStateVector(const unsigned int count, dTrackerBase* trackers, HRESULT* results)
+{
+    if (tracker_vector_ == nullptr) return E_FAIL;
+    if (count > 0 && (trackers == nullptr || results == nullptr)) return E_POINTER;
+
+    // Apply all states, S_FALSE if any of them didn't succeed
+    auto result = S_OK;
+    for (unsigned int i = 0; i < count; i++)
+        if ((results[i] = SetTrackerState(trackers[i])) != S_OK) result = S_FALSE;
+
+    return result;
+}
+
+HRESULT DriverService::UpdateTrackerVector(const unsigned int count, dTrackerBase* trackers, HRESULT* results)
+{
+    if (tracker_vector_ == nullptr) return E_FAIL;
+    if (count > 0 && (trackers == nullptr || results == nullptr)) return E_POINTER;
+
+    // Apply all poses, S_FALSE if any of them didn't succeed
+    auto result = S_OK;
+    for (unsigned int i = 0; i < count; i++)
+        if ((results[i] = UpdateTracker(trackers[i])) != S_OK) result = S_FALSE;
+
+    return result;
+}
+
 HRESULT DriverService::RequestVrRestart(wchar_t* message)
 {
     // Sanity check
@@ -123,8 +148,9 @@ HRESULT DriverService::PingDriverService(long long* ms)
         return ERROR_EMPTY; // Compose the reply
     }
 
-    // Perform the request
-    *ms = std::chrono::system_clock::now().time_since_epoch().count();
+    // Perform the request (Unix time, use ProbeLatency for measurements)
+    *ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
 
     return S_OK; // Compose the reply
 }
@@ -157,7 +183,10 @@ void DriverService::RegisterOverrideSetHandler(
 
 HRESULT DriverService::UpdateInputBoolean(dTrackerType tracker, wchar_t* path, boolean value)
 {
-    if (path == nullptr || WStringToString(path).empty())
+    if (tracker_vector_ == nullptr) return E_FAIL;
+
+    const auto path_string = path ? WStringToString(path) : std::string();
+    if (path_string.empty())
     {
         logMessage("Couldn't update an input component. The path string is empty.");
         return ERROR_EMPTY; // Compose the reply
@@ -165,7 +194,7 @@ HRESULT DriverService::UpdateInputBoolean(dTrackerType tracker, wchar_t* path, b
 
     if (tracker_vector_->contains(static_cast<ITrackerType>(tracker)))
         return tracker_vector_->at(static_cast<ITrackerType>(tracker))
-                              .update_input(WStringToString(path), static_cast<bool>(value))
+                              .update_input(path_string, static_cast<bool>(value))
                    ? S_OK
                    : ERROR_INVALID_ACCESS;
 
@@ -174,7 +203,10 @@ HRESULT DriverService::UpdateInputBoolean(dTrackerType tracker, wchar_t* path, b
 
 HRESULT DriverService::UpdateInputScalar(dTrackerType tracker, wchar_t* path, float value)
 {
-    if (path == nullptr || WStringToString(path).empty())
+    if (tracker_vector_ == nullptr) return E_FAIL;
+
+    const auto path_string = path ? WStringToString(path) : std::string();
+    if (path_string.empty())
     {
         logMessage("Couldn't update an input component. The path string is empty.");
         return ERROR_EMPTY; // Compose the reply
@@ -182,13 +214,243 @@ HRESULT DriverService::UpdateInputScalar(dTrackerType tracker, wchar_t* path, fl
 
     if (tracker_vector_->contains(static_cast<ITrackerType>(tracker)))
         return tracker_vector_->at(static_cast<ITrackerType>(tracker))
-                              .update_input(WStringToString(path), value)
+                              .update_input(path_string, value)
+                   ? S_OK
+                   : ERROR_INVALID_ACCESS;
+
+    return ERROR_INVALID_INDEX; // Not available
+}
+
+HRESULT DriverService::RegisterInputAction(dTrackerType tracker, wchar_t* path, unsigned int* token)
+{
+    if (tracker_vector_ == nullptr) return E_FAIL;
+    if (token == nullptr) return E_POINTER;
+    *token = k_invalid_input_token; // Until resolved
+
+    const auto path_string = path ? WStringToString(path) : std::string();
+    if (path_string.empty())
+    {
+        logMessage("Couldn't register an input action. The path string is empty.");
+        return ERROR_EMPTY; // Compose the reply
+    }
+
+    if (!tracker_vector_->contains(static_cast<ITrackerType>(tracker)))
+        return ERROR_INVALID_INDEX; // Not available
+
+    *token = tracker_vector_->at(static_cast<ITrackerType>(tracker)).resolve_input(path_string);
+    if (*token == k_invalid_input_token)
+    {
+        logMessage(std::format("Couldn't register input action {} for tracker ID {}. The path is unknown.",
+                               path_string, static_cast<int>(tracker)));
+        return ERROR_NOT_FOUND;
+    }
+
+    return S_OK; // Compose the reply
+}
+
+HRESULT DriverService::UpdateInputBooleanToken(dTrackerType tracker, unsigned int token, boolean value)
+{
+    if (tracker_vector_ == nullptr) return E_FAIL;
+
+    if (tracker_vector_->contains(static_cast<ITrackerType>(tracker)))
+        return tracker_vector_->at(static_cast<ITrackerType>(tracker))
+                              .update_input(token, static_cast<bool>(value))
+                   ? S_OK
+                   : ERROR_INVALID_ACCESS;
+
+    return ERROR_INVALID_INDEX; // Not available
+}
+
+HRESULT DriverService::UpdateInputScalarToken(dTrackerType tracker, unsigned int token, float value)
+{
+    if (tracker_vector_ == nullptr) return E_FAIL;
+
+    if (tracker_vector_->contains(static_cast<ITrackerType>(tracker)))
+        return tracker_vector_->at(static_cast<ITrackerType>(tracker))
+                              .update_input(token, value)
+                   ? S_OK
+                   : ERROR_INVALID_ACCESS;
+
+    return ERROR_INVALID_INDEX; // Not available
+}
+
+HRESULT DriverService::UpdateInputVector(dTrackerType tracker, const __int64 timestamp, const unsigned int count,
+                                         dInputUpdate* updates, HRESULT* results)
+{
+    if (tracker_vector_ == nullptr) return E_FAIL;
+    if (count > 0 && (updates == nullptr || results == nullptr)) return E_POINTER;
+
+    if (!tracker_vector_->contains(static_cast<ITrackerType>(tracker)))
+        return ERROR_INVALID_INDEX; // Not available
+
+    // The whole frame shares one time offset, so all components stay coherent
+    const auto& p_tracker = tracker_vector_->at(static_cast<ITrackerType>(tracker));
+    const auto time_offset = sample_time_offset(timestamp);
+
+    // Apply all updates, S_FALSE if any of them didn't succeed
+    auto result = S_OK;
+    for (unsigned int i = 0; i < count; i++)
+    {
+        const auto success = updates[i].IsScalar
+                                 ? p_tracker.update_input(updates[i].Token, updates[i].Value, time_offset)
+                                 : p_tracker.update_input(updates[i].Token, updates[i].Value != 0.0f, time_offset);
+
+        if ((results[i] = success ? S_OK : ERROR_INVALID_ACCESS) != S_OK) result = S_FALSE;
+    }
+
+    return result;
+}
+
+HRESULT DriverService::UpdateSkeleton(dTrackerType tracker, dSkeletonPose* skeleton)
+{
+    if (tracker_vector_ == nullptr) return E_FAIL;
+    if (skeleton == nullptr) return E_POINTER;
+
+    if (tracker_vector_->contains(static_cast<ITrackerType>(tracker)))
+        return tracker_vector_->at(static_cast<ITrackerType>(tracker)).update_skeleton(*skeleton)
                    ? S_OK
                    : ERROR_INVALID_ACCESS;
 
     return ERROR_INVALID_INDEX; // Not available
 }
 
+HRESULT DriverService::PollHapticEvents(const unsigned int capacity, dHapticEvent* events, unsigned int* count)
+{
+    if (count == nullptr || (capacity > 0 && events == nullptr)) return E_POINTER;
+    *count = 0; // Nothing yet
+
+    if (haptic_events_ == nullptr) return E_FAIL;
+
+    // Concurrent polls are serialized here, the producer never waits
+    std::lock_guard lock(haptic_mutex_);
+    while (*count < capacity && haptic_events_->try_pop(
+        [&](const dHapticEvent& event) { events[*count] = event; }))
+        ++*count;
+
+    return *count > 0 ? S_OK : S_FALSE;
+}
+
+HRESULT DriverService::SetWorldFromDriverTransform(const dVector3 translation, const dQuaternion rotation)
+{
+    const auto norm = std::sqrt(rotation.W * rotation.W + rotation.X * rotation.X +
+        rotation.Y * rotation.Y + rotation.Z * rotation.Z);
+
+    if (!std::isfinite(norm) || norm < 1e-6f) return E_INVALIDARG;
+
+    // Published at once, picked up by all trackers on the next frame
+    g_world_from_driver.store({
+        .rotation = {rotation.W / norm, rotation.X / norm, rotation.Y / norm, rotation.Z / norm},
+        .translation = {translation.X, translation.Y, translation.Z}
+    });
+
+    logFormat("Playspace transform set to ({}, {}, {}), ({}, {}, {}, {})",
+              translation.X, translation.Y, translation.Z, rotation.W, rotation.X, rotation.Y, rotation.Z);
+    return S_OK;
+}
+
+HRESULT DriverService::UpdateTrackerCompact(const dPoseSample pose)
+{
+    if (pose.Role > TrackerRightHand)
+    {
+        poses_rejected_.fetch_add(1, std::memory_order_relaxed);
+        return ERROR_INVALID_INDEX; // Not available
+    }
+
+    return UpdateTracker(expand_pose_sample(pose));
+}
+
+HRESULT DriverService::UpdateTrackerQuantizedVector(const __int64 timestamp, const dVector3 origin,
+                                                    const unsigned int count, dQuantizedPose* poses, HRESULT* results)
+{
+    if (tracker_vector_ == nullptr) return E_FAIL;
+    if (count > 0 && (poses == nullptr || results == nullptr)) return E_POINTER;
+
+    // Expand and apply all poses, S_FALSE if any of them didn't succeed
+    auto result = S_OK;
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if (poses[i].Role <= TrackerRightHand)
+            results[i] = UpdateTracker(decode_quantized_pose(poses[i], origin, timestamp));
+        else
+        {
+            poses_rejected_.fetch_add(1, std::memory_order_relaxed);
+            results[i] = ERROR_INVALID_INDEX;
+        }
+
+        if (results[i] != S_OK) result = S_FALSE;
+    }
+
+    return result;
+}
+
+HRESULT DriverService::SubmitTrackerPoses(const unsigned int count, dPoseSample* poses)
+{
+    if (tracker_vector_ == nullptr) return E_FAIL;
+    if (count > 0 && poses == nullptr) return E_POINTER;
+
+    // Per-pose results are only counted, nobody waits on them
+    for (unsigned int i = 0; i < count; i++)
+        UpdateTrackerCompact(poses[i]);
+
+    return S_OK;
+}
+
+HRESULT DriverService::GetSubmissionStats(dSubmissionStats* stats)
+{
+    if (stats == nullptr) return E_POINTER;
+    if (tracker_vector_ == nullptr) return E_FAIL;
+
+    uint64_t coalesced = 0;
+    for (const auto& tracker : *tracker_vector_ | std::views::values)
+        coalesced += tracker.overwritten_samples();
+
+    *stats = dSubmissionStats{
+        .Received = static_cast<__int64>(poses_received_.load(std::memory_order_relaxed)),
+        .Rejected = static_cast<__int64>(poses_rejected_.load(std::memory_order_relaxed)),
+        .Coalesced = static_cast<__int64>(coalesced)
+    };
+
+    return S_OK;
+}
+
+HRESULT DriverService::ProbeLatency(__int64* received, __int64* replied)
+{
+    const auto now = AME_API_GET_STEADY_TIMESTAMP_NOW;
+    if (received == nullptr || replied == nullptr) return E_POINTER;
+
+    *received = now;
+    *replied = AME_API_GET_STEADY_TIMESTAMP_NOW;
+    return S_OK;
+}
+
+HRESULT DriverService::GetPoseLatency(dTrackerType tracker, dPoseTransport transport,
+                                      dLatencyStats* arrival, dLatencyStats* consumption)
+{
+    if (tracker_vector_ == nullptr) return E_FAIL;
+    if (arrival == nullptr || consumption == nullptr) return E_POINTER;
+    if (transport < 0 || transport >= k_pose_transport_count) return E_INVALIDARG;
+
+    const auto summary = [](const LatencyHistogram& histogram)
+    {
+        return dLatencyStats{
+            .Count = static_cast<__int64>(histogram.count()),
+            .Median = histogram.percentile(0.5),
+            .P99 = histogram.percentile(0.99)
+        };
+    };
+
+    if (tracker_vector_->contains(static_cast<ITrackerType>(tracker)))
+    {
+        const auto& body_tracker = tracker_vector_->at(static_cast<ITrackerType>(tracker));
+        *arrival = summary(body_tracker.latency(transport));
+        *consumption = summary(body_tracker.consumption_latency());
+        return S_OK;
+    }
+
+    *arrival = *consumption = {};
+    return ERROR_INVALID_INDEX; // Not available
+}
+
 DriverService::~DriverService()
 {
     //winrt::check_hresult(RevokeActiveObject(register_cookie_, nullptr));
@@ -225,6 +487,11 @@ void DriverService::TrackerVector(std::map<ITrackerType, BodyTracker>* const& ve
     tracker_vector_ = vector;
 }
 
+void DriverService::HapticEvents(HapticEventQueue* const& queue)
+{
+    haptic_events_ = queue;
+}
+
 void DriverService::RebuildCallback(IRebuildCallback* callback)
 {
     rebuild_callback_ = callback;
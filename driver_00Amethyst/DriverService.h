@@ -13,8 +13,11 @@
 #include "BodyTracker.h"
 #include "driver_Amethyst.h"
 #include "wilx.hpp"
+#include <atomic>
 #include <functional>
+#include <mutex>
 #include "Logging.h"
+#include "util/mpsc_ring.hpp"
 
 namespace winrt
 {
@@ -26,6 +29,9 @@ _Check_return_ HRESULT STDAPICALLTYPE DLLGETCLASSOBJECT_ENTRY(
     _In_ REFCLSID rclsid, _In_ REFIID riid, _Outptr_ void** ppv);
 }
 
+// Haptic requests from RunFrame (single producer) to PollHapticEvents
+using HapticEventQueue = Util::mpsc_ring<dHapticEvent, 64>;
+
 struct IRebuildCallback
 {
     virtual void OnRebuildRequested() = 0;
@@ -59,12 +65,53 @@ public:
     HRESULT STDMETHODCALLTYPE UpdateInputBoolean(dTrackerType tracker, wchar_t* path, boolean value) override;
     HRESULT STDMETHODCALLTYPE UpdateInputScalar(dTrackerType tracker, wchar_t* path, float value) override;
 
+    // Resolve an action GUID (or component path) once, then update it by token
+    HRESULT STDMETHODCALLTYPE RegisterInputAction(dTrackerType tracker, wchar_t* path, unsigned int* token) override;
+    HRESULT STDMETHODCALLTYPE UpdateInputBooleanToken(dTrackerType tracker, unsigned int token, boolean value) override;
+    HRESULT STDMETHODCALLTYPE UpdateInputScalarToken(dTrackerType tracker, unsigned int token, float value) override;
+
+    // All input changes of one tracker frame, sharing one capture timestamp (steady clock microseconds)
+    HRESULT STDMETHODCALLTYPE UpdateInputVector(dTrackerType tracker, __int64 timestamp, unsigned int count,
+                                                dInputUpdate* updates, HRESULT* results) override;
+
+    // Packed 31-bone hand skeleton, hands only
+    HRESULT STDMETHODCALLTYPE UpdateSkeleton(dTrackerType tracker, dSkeletonPose* skeleton) override;
+
+    // Drain up to 'capacity' pending haptic requests, S_FALSE if there were none
+    HRESULT STDMETHODCALLTYPE PollHapticEvents(unsigned int capacity, dHapticEvent* events, unsigned int* count) override;
+
+    // Playspace transform applied by SteamVR to all tracker poses (sent in driver space)
+    HRESULT STDMETHODCALLTYPE SetWorldFromDriverTransform(dVector3 translation, dQuaternion rotation) override;
+
+    // Same as UpdateTracker, from the fixed-layout packet (no serial, flags instead of nullables)
+    HRESULT STDMETHODCALLTYPE UpdateTrackerCompact(dPoseSample pose) override;
+
+    // Quantized batch sharing one origin and capture timestamp, per-tracker results in 'results'
+    HRESULT STDMETHODCALLTYPE UpdateTrackerQuantizedVector(__int64 timestamp, dVector3 origin, unsigned int count,
+                                                           dQuantizedPose* poses, HRESULT* results) override;
+
+    // No per-pose results: failures only show up in GetSubmissionStats
+    HRESULT STDMETHODCALLTYPE SubmitTrackerPoses(unsigned int count, dPoseSample* poses) override;
+    HRESULT STDMETHODCALLTYPE GetSubmissionStats(dSubmissionStats* stats) override;
+
+    // Steady clock (QPC) microseconds at which the call arrived and returned, for round-trip probes
+    HRESULT STDMETHODCALLTYPE ProbeLatency(__int64* received, __int64* replied) override;
+
+    // Sender timestamp to driver arrival, and to the RunFrame that applied the sample
+    HRESULT STDMETHODCALLTYPE GetPoseLatency(dTrackerType tracker, dPoseTransport transport,
+                                             dLatencyStats* arrival, dLatencyStats* consumption) override;
+
+    // Batched variants: one call for all trackers, per-tracker results in 'results'
+    HRESULT STDMETHODCALLTYPE SetTrackerStateVector(unsigned int count, dTrackerBase* trackers, HRESULT* results) override;
+    HRESULT STDMETHODCALLTYPE UpdateTrackerVector(unsigned int count, dTrackerBase* trackers, HRESULT* results) override;
+
     ~DriverService() override;
 
     static void InstallProxyStub();
     static void UninstallProxyStub();
 
     void TrackerVector(std::map<ITrackerType, BodyTracker>* const& vector);
+    void HapticEvents(HapticEventQueue* const& queue);
     void RebuildCallback(IRebuildCallback* callback);
 
     ULONG __stdcall Release() noexcept override;
@@ -76,6 +123,12 @@ private:
     IRebuildCallback* rebuild_callback_ = nullptr;
     std::map<ITrackerType, BodyTracker>* tracker_vector_;
 
+    // Pose submission counters, see GetSubmissionStats
+    std::atomic<uint64_t> poses_received_{0}, poses_rejected_{0};
+
+    HapticEventQueue* haptic_events_ = nullptr;
+    std::mutex haptic_mutex_; // The queue has a single consumer
+
     std::function<HRESULT(const uint32_t& id, dDriverPose pose)> pose_update_handler_;
     std::function<HRESULT(const uint32_t& id, bool isEnabled)> override_set_handler_;
 
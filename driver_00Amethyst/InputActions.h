@@ -0,0 +1,221 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <openvr_driver.h>
+
+// Input components of the emulated Touch controllers,
+// each one has a slot in BodyTracker's flat handle array
+enum InputComponent : std::uint8_t
+{
+    Input_SystemClick,
+    Input_AClick,
+    Input_ATouch,
+    Input_BClick,
+    Input_BTouch,
+    Input_XClick,
+    Input_XTouch,
+    Input_YClick,
+    Input_YTouch,
+    Input_TriggerTouch,
+    Input_GripTouch,
+    Input_JoystickClick,
+    Input_JoystickTouch,
+    Input_GripValue,
+    Input_TriggerValue,
+    Input_JoystickX,
+    Input_JoystickY,
+    Input_ComponentCount
+};
+
+// Bones in the OpenVR hand skeleton (/skeleton/hand/left|right)
+inline constexpr std::uint32_t k_skeleton_bone_count = 31;
+
+enum InputHand : std::uint8_t
+{
+    InputHand_Left,
+    InputHand_Right,
+    InputHand_Both // Components only
+};
+
+enum InputActionHandlingMode : std::uint8_t
+{
+    ModeInvalid,
+    ModeScalar, // Move true=1.0, false=0.0
+    ModeBoolean, // Move to bool as >=0.5f
+    ModeHasValue // True if .first is not 0
+};
+
+struct InputComponentInfo
+{
+    std::string_view path;
+    InputHand hand;
+    bool scalar;
+    vr::EVRScalarUnits units = vr::VRScalarUnits_NormalizedOneSided;
+};
+
+struct InputActionBinding
+{
+    InputComponent component;
+    InputActionHandlingMode mode;
+};
+
+struct InputActionInfo
+{
+    std::string_view guid;
+    InputHand hand;
+    std::array<InputActionBinding, 2> bindings;
+    std::uint8_t binding_count;
+};
+
+// Indexed by InputComponent
+inline constexpr std::array<InputComponentInfo, Input_ComponentCount> k_input_components{
+    {
+        {"/input/system/click", InputHand_Both, false},
+        {"/input/a/click", InputHand_Right, false},
+        {"/input/a/touch", InputHand_Right, false},
+        {"/input/b/click", InputHand_Right, false},
+        {"/input/b/touch", InputHand_Right, false},
+        {"/input/x/click", InputHand_Left, false},
+        {"/input/x/touch", InputHand_Left, false},
+        {"/input/y/click", InputHand_Left, false},
+        {"/input/y/touch", InputHand_Left, false},
+        {"/input/trigger/touch", InputHand_Both, false},
+        {"/input/grip/touch", InputHand_Both, false},
+        {"/input/joystick/click", InputHand_Both, false},
+        {"/input/joystick/touch", InputHand_Both, false},
+        {"/input/grip/value", InputHand_Both, true},
+        {"/input/trigger/value", InputHand_Both, true},
+        {"/input/joystick/x", InputHand_Both, true, vr::VRScalarUnits_NormalizedTwoSided},
+        {"/input/joystick/y", InputHand_Both, true, vr::VRScalarUnits_NormalizedTwoSided}
+    }
+};
+
+// Well-known actions sent by the plugin, keyed by their GUIDs
+inline constexpr std::array<InputActionInfo, 14> k_input_actions{
+    {
+        // Left hand
+        {"1A3ABE96-B1B3-4ABF-9969-C87BB15B2C13", InputHand_Left, {{{Input_SystemClick, ModeBoolean}}}, 1},
+        {
+            "54B78337-23B6-4E36-A9C8-047061FB9256", InputHand_Left,
+            {{{Input_TriggerValue, ModeScalar}, {Input_TriggerTouch, ModeBoolean}}}, 2
+        },
+        {
+            "36DE93FB-01DD-4DEC-ACE6-E9ADD96027B7", InputHand_Left,
+            {{{Input_GripValue, ModeScalar}, {Input_GripTouch, ModeBoolean}}}, 2
+        },
+        {
+            "DAE6AD34-B3E4-46D0-AFEE-1CACFB1387A1", InputHand_Left,
+            {{{Input_XClick, ModeBoolean}, {Input_XTouch, ModeBoolean}}}, 2
+        },
+        {
+            "130B197B-EFC9-4A3A-9D3F-91A35BB83291", InputHand_Left,
+            {{{Input_YClick, ModeBoolean}, {Input_YTouch, ModeBoolean}}}, 2
+        },
+        {
+            "5F519116-9A5C-48BA-9693-D9A3741AF0AB", InputHand_Left,
+            {{{Input_JoystickX, ModeScalar}, {Input_JoystickTouch, ModeHasValue}}}, 2
+        },
+        {
+            "FF80F249-7F8D-4FA1-AC88-B9A1F5D623CB", InputHand_Left,
+            {{{Input_JoystickY, ModeScalar}, {Input_JoystickTouch, ModeHasValue}}}, 2
+        },
+
+        // Right hand
+        {"6169CB90-4997-4266-AC33-83FF3FEF16AA", InputHand_Right, {{{Input_SystemClick, ModeBoolean}}}, 1},
+        {
+            "CC84BF86-6846-4A7D-9111-7919F22D0FA7", InputHand_Right,
+            {{{Input_TriggerValue, ModeScalar}, {Input_TriggerTouch, ModeBoolean}}}, 2
+        },
+        {
+            "65EAFD83-C5D6-496F-BA3C-7FB0F9FED824", InputHand_Right,
+            {{{Input_GripValue, ModeScalar}, {Input_GripTouch, ModeBoolean}}}, 2
+        },
+        {
+            "98279522-D951-4EAC-9705-71EB5A9151D0", InputHand_Right,
+            {{{Input_AClick, ModeBoolean}, {Input_ATouch, ModeBoolean}}}, 2
+        },
+        {
+            "1D7238C7-3391-44BA-B40F-5F33AEE64114", InputHand_Right,
+            {{{Input_BClick, ModeBoolean}, {Input_BTouch, ModeBoolean}}}, 2
+        },
+        {
+            "46CD8C05-16F6-42D5-9265-133E57E0933B", InputHand_Right,
+            {{{Input_JoystickX, ModeScalar}, {Input_JoystickTouch, ModeHasValue}}}, 2
+        },
+        {
+            "14E62950-A538-422E-B688-82CCB5B1E179", InputHand_Right,
+            {{{Input_JoystickY, ModeScalar}, {Input_JoystickTouch, ModeHasValue}}}, 2
+        }
+    }
+};
+
+// Collision-free string lookup, the seed is searched for at compile time
+template <std::size_t Size>
+struct InputPerfectHash
+{
+    std::uint32_t seed = 0;
+    std::array<std::uint8_t, Size> slots{}; // Key index + 1, 0 if empty
+
+    static constexpr std::uint32_t hash(const std::string_view key, const std::uint32_t seed)
+    {
+        auto value = 2166136261u ^ seed; // FNV-1a
+        for (const auto c : key)
+        {
+            value ^= static_cast<std::uint8_t>(c);
+            value *= 16777619u;
+        }
+        return value;
+    }
+
+    // Index of the key (still compared, unknown keys can land anywhere), -1 if not found
+    template <typename Keys, typename Project>
+    constexpr int find(const std::string_view key, const Keys& keys, Project project) const
+    {
+        const auto slot = slots[hash(key, seed) % Size];
+        return slot > 0 && project(keys[slot - 1]) == key ? slot - 1 : -1;
+    }
+};
+
+template <std::size_t Size, typename Keys, typename Project>
+consteval InputPerfectHash<Size> make_input_hash(const Keys& keys, Project project)
+{
+    static_assert(std::tuple_size_v<Keys> < Size && Size < 256);
+    for (std::uint32_t seed = 0;; seed++)
+    {
+        InputPerfectHash<Size> table{.seed = seed};
+        auto perfect = true;
+
+        for (std::size_t i = 0; i < keys.size() && perfect; i++)
+        {
+            auto& slot = table.slots[InputPerfectHash<Size>::hash(project(keys[i]), seed) % Size];
+            if (slot != 0) perfect = false;
+            else slot = static_cast<std::uint8_t>(i + 1);
+        }
+
+        if (perfect) return table;
+    }
+}
+
+inline constexpr auto k_input_action_hash =
+    make_input_hash<64>(k_input_actions, [](const InputActionInfo& action) { return action.guid; });
+
+inline constexpr auto k_input_component_hash =
+    make_input_hash<64>(k_input_components, [](const InputComponentInfo& component) { return component.path; });
+
+// Action GUID to its index in k_input_actions, -1 if unknown
+constexpr int find_input_action(const std::string_view guid)
+{
+    return k_input_action_hash.find(guid, k_input_actions, [](const InputActionInfo& action) { return action.guid; });
+}
+
+// Component path to its InputComponent, -1 if unknown
+constexpr int find_input_component(const std::string_view path)
+{
+    return k_input_component_hash.find(path, k_input_components,
+                                       [](const InputComponentInfo& component) { return component.path; });
+}
+
+static_assert(find_input_action("14E62950-A538-422E-B688-82CCB5B1E179") == 13);
+static_assert(find_input_component("/input/joystick/y") == Input_JoystickY);
+static_assert(find_input_component("/input/unknown") == -1);
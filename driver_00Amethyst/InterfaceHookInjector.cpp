@@ -28,7 +28,7 @@ TrackedDevicePoseUpdatedHook006("IVRServerDriverHost006::TrackedDevicePoseUpdate
 static void DetourTrackedDevicePoseUpdated005(vr::IVRServerDriverHost* _this, uint32_t unWhichDevice,
                                               const vr::DriverPose_t& newPose, uint32_t unPoseStructSize)
 {
-    logMessageVerbose("ServerTrackedDeviceProvider::DetourTrackedDevicePoseUpdated(%d)", unWhichDevice);
+    LOG_VERBOSE("ServerTrackedDeviceProvider::DetourTrackedDevicePoseUpdated(%d)", unWhichDevice);
     auto pose = newPose;
     if (Driver->HandleDevicePoseUpdated(unWhichDevice, pose))
     {
@@ -39,7 +39,7 @@ static void DetourTrackedDevicePoseUpdated005(vr::IVRServerDriverHost* _this, ui
 static void DetourTrackedDevicePoseUpdated006(vr::IVRServerDriverHost* _this, uint32_t unWhichDevice,
                                               const vr::DriverPose_t& newPose, uint32_t unPoseStructSize)
 {
-    logMessageVerbose("ServerTrackedDeviceProvider::DetourTrackedDevicePoseUpdated(%d)", unWhichDevice);
+    LOG_VERBOSE("ServerTrackedDeviceProvider::DetourTrackedDevicePoseUpdated(%d)", unWhichDevice);
     auto pose = newPose;
     if (Driver->HandleDevicePoseUpdated(unWhichDevice, pose))
     {
@@ -50,7 +50,7 @@ static void DetourTrackedDevicePoseUpdated006(vr::IVRServerDriverHost* _this, ui
 static void* DetourGetGenericInterface(vr::IVRDriverContext* _this, const char* pchInterfaceVersion,
                                        vr::EVRInitError* peError)
 {
-    logMessageVerbose("ServerTrackedDeviceProvider::DetourGetGenericInterface(%s)", pchInterfaceVersion);
+    LOG_VERBOSE("ServerTrackedDeviceProvider::DetourGetGenericInterface(%s)", pchInterfaceVersion);
     auto originalInterface = GetGenericInterfaceHook.originalFunc(_this, pchInterfaceVersion, peError);
 
     std::string iface(pchInterfaceVersion);
@@ -88,7 +88,7 @@ void InjectHooks(ServerProvider* driver, vr::IVRDriverContext* pDriverContext)
     }
     else
     {
-        logMessage("MH_Initialize error: %s", MH_StatusToString(err));
+        logMessage(std::format("MH_Initialize error: {}", MH_StatusToString(err)));
     }
 }
 
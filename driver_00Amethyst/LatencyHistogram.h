@@ -0,0 +1,75 @@
+#pragma once
+#include <atomic>
+#include <bit>
+#include <cstdint>
+
+// Lock-free log2 histogram of latencies in microseconds.
+// Bucket i holds samples in [2^i, 2^(i+1)) us, bucket 0 also holds 0.
+class LatencyHistogram
+{
+public:
+    static constexpr std::size_t bucket_count = 24; // Up to ~16s
+
+    LatencyHistogram() = default;
+
+    LatencyHistogram(const LatencyHistogram& other)
+    {
+        copy_from(other);
+    }
+
+    LatencyHistogram& operator=(const LatencyHistogram& other)
+    {
+        if (this != &other) copy_from(other);
+        return *this;
+    }
+
+    void record(const long long microseconds)
+    {
+        const auto value = microseconds > 0 ? static_cast<std::uint64_t>(microseconds) : 0;
+        auto bucket = static_cast<std::size_t>(std::bit_width(value));
+        if (bucket > 0) bucket--; // bit_width(1) == 1
+        if (bucket >= bucket_count) bucket = bucket_count - 1;
+
+        buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+        total_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t count() const
+    {
+        return total_.load(std::memory_order_relaxed);
+    }
+
+    // Upper bound (us) of the bucket containing the given percentile [0, 1]
+    [[nodiscard]] long long percentile(const double fraction) const
+    {
+        const auto total = count();
+        if (total == 0) return 0;
+
+        const auto target = static_cast<std::uint64_t>(fraction * static_cast<double>(total - 1)) + 1;
+        std::uint64_t seen = 0;
+
+        for (std::size_t i = 0; i < bucket_count; i++)
+            if ((seen += buckets_[i].load(std::memory_order_relaxed)) >= target)
+                return (1ll << (i + 1)) - 1;
+
+        return (1ll << bucket_count) - 1;
+    }
+
+    void reset()
+    {
+        for (auto& bucket : buckets_)
+            bucket.store(0, std::memory_order_relaxed);
+        total_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    void copy_from(const LatencyHistogram& other)
+    {
+        for (std::size_t i = 0; i < bucket_count; i++)
+            buckets_[i].store(other.buckets_[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        total_.store(other.total_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    std::atomic<std::uint64_t> buckets_[bucket_count] = {};
+    std::atomic<std::uint64_t> total_ = 0;
+};
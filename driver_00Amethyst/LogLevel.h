@@ -0,0 +1,32 @@
+#pragma once
+#include <atomic>
+
+// Verbose logging is compiled in for debug builds only,
+// override by defining AME_LOG_VERBOSE to 0 or 1
+#ifndef AME_LOG_VERBOSE
+#ifdef _DEBUG
+#define AME_LOG_VERBOSE 1
+#else
+#define AME_LOG_VERBOSE 0
+#endif
+#endif
+
+enum LogLevel : int
+{
+    LogLevel_Info = 0,
+    LogLevel_Verbose = 1
+};
+
+// Runtime log level, checked before any formatting
+inline std::atomic<int> g_log_level{LogLevel_Info};
+
+inline bool isVerboseLoggingEnabled()
+{
+    return AME_LOG_VERBOSE && g_log_level.load(std::memory_order_relaxed) >= LogLevel_Verbose;
+}
+
+// Verbose log: compiles to nothing when AME_LOG_VERBOSE is 0,
+// otherwise costs a single relaxed load when disabled at runtime.
+// logMessageVerbose (Logging.h) is only referenced when compiled in
+#define LOG_VERBOSE(...) \
+    do { if constexpr (AME_LOG_VERBOSE) { if (isVerboseLoggingEnabled()) logMessageVerbose(__VA_ARGS__); } } while (0)
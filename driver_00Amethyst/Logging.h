@@ -6,6 +6,7 @@
 //
 
 #pragma once
+#include <format>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string>
@@ -13,36 +14,48 @@
 #include <openvr_driver.h>
 #include <windows.h>
 
-inline void logMessage(const std::string& message, ...)
-{
-    va_list args;
-    char buffer[2048];
-
-    auto fmt = message.c_str();
+#include "LogLevel.h"
+#include "util/async_logger.hpp"
 
-    va_start(args, fmt);
-    vsprintf(buffer, fmt, args);
-    va_end(args);
-    
+// Final sink, called from the logger thread (or directly when it's not running)
+inline void logToDriver(const char* message)
+{
     if (vr::VRDriverContext() && vr::VRDriverLog())
     {
-        vr::VRDriverLog()->Log(buffer);
+        vr::VRDriverLog()->Log(message);
     }
     else
     {
-        OutputDebugStringA(buffer);
+        OutputDebugStringA(message);
     }
 }
 
-inline void logMessageVerbose(const std::string& message, ...)
+// Messages are queued and written out by a background thread,
+// so logging never blocks the COM or SteamVR threads.
+// Started once Init succeeds and stopped in Cleanup; never destroyed,
+// so nothing joins the writer thread while the driver is unloading.
+inline Util::async_logger<>& g_driver_log = *new Util::async_logger<>{&logToDriver};
+
+inline void logMessage(const std::string& message)
+{
+    g_driver_log.post(message);
+}
+
+// Deferred formatting: arithmetic arguments are formatted on the logger thread
+template <typename... Args>
+void logFormat(std::format_string<Args...> fmt, Args&&... args)
+{
+    g_driver_log.post(fmt, std::forward<Args>(args)...);
+}
+
+// Prefer LOG_VERBOSE, which skips the formatting when disabled
+inline void logMessageVerbose(const char* fmt, ...)
 {
     va_list args;
     char buffer[2048];
 
-    auto fmt = message.c_str();
-
     va_start(args, fmt);
-    vsprintf(buffer, fmt, args);
+    vsnprintf(buffer, sizeof buffer, fmt, args);
     va_end(args);
 
     OutputDebugStringA(buffer);
@@ -0,0 +1,87 @@
+#include "PoseChannel.h"
+
+#include <format>
+#include <windows.h>
+
+#include "Logging.h"
+
+bool PoseChannel::open(const wchar_t* name)
+{
+    if (is_open()) return true;
+
+    const auto mapping = CreateFileMappingW(
+        INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+        0, sizeof(PoseChannelLayout), name);
+
+    if (mapping == nullptr)
+    {
+        logMessage(std::format("Couldn't create the pose channel, error: {}", GetLastError()));
+        return false;
+    }
+
+    const auto view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(PoseChannelLayout));
+    if (view == nullptr)
+    {
+        logMessage(std::format("Couldn't map the pose channel, error: {}", GetLastError()));
+        CloseHandle(mapping);
+        return false;
+    }
+
+    // Fresh mappings are zero-filled, which is a valid (empty) seqlock state
+    mapping_ = mapping;
+    layout_ = static_cast<PoseChannelLayout*>(view);
+
+    // The region outlives the driver while a client holds it open: skip whatever was written
+    // before (stale poses), only samples published from now on are read. A write in flight
+    // completes to a newer version and is picked up.
+    for (std::size_t slot = 0; slot < k_pose_channel_slots; slot++)
+        last_versions_[slot] = layout_->slots[slot].version();
+
+    // Publish the header last, the client checks it before writing
+    layout_->header.slot_count = static_cast<std::uint32_t>(k_pose_channel_slots);
+    layout_->header.slot_size = static_cast<std::uint32_t>(sizeof(Util::seqlock<PoseChannelSample>));
+    layout_->header.version = k_pose_channel_version;
+    std::atomic_thread_fence(std::memory_order_release);
+    layout_->header.magic = k_pose_channel_magic;
+
+    logMessage("Pose channel opened");
+    return true;
+}
+
+void PoseChannel::close()
+{
+    if (layout_ != nullptr)
+    {
+        // Clients holding the mapping open fall back to COM right away
+        layout_->header.heartbeat.store(0, std::memory_order_release);
+        UnmapViewOfFile(layout_);
+        layout_ = nullptr;
+    }
+
+    if (mapping_ != nullptr)
+    {
+        CloseHandle(mapping_);
+        mapping_ = nullptr;
+    }
+}
+
+void PoseChannel::beat(const std::int64_t now_us)
+{
+    if (is_open()) layout_->header.heartbeat.store(now_us, std::memory_order_release);
+}
+
+bool PoseChannel::try_read(const std::size_t slot, PoseChannelSample& sample)
+{
+    if (!is_open() || slot >= k_pose_channel_slots) return false;
+
+    // Cheap check first: nothing new since the last read
+    const auto version = layout_->slots[slot].version();
+    if (version == last_versions_[slot]) return false;
+
+    std::uint32_t read_version = 0;
+    if (!layout_->slots[slot].try_load(sample, &read_version))
+        return false;
+
+    last_versions_[slot] = read_version;
+    return true;
+}
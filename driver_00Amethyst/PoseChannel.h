@@ -0,0 +1,89 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "util/seqlock.hpp"
+
+// Name of the shared memory region created by the driver
+inline constexpr wchar_t k_pose_channel_name[] = L"Local\\AmethystPoseChannel";
+
+// Bump when PoseChannelLayout changes
+inline constexpr std::uint32_t k_pose_channel_magic = 0x4C484350; // 'PCHL'
+inline constexpr std::uint32_t k_pose_channel_version = 3;
+
+// One slot for each dTrackerType (including TrackerHead)
+inline constexpr std::size_t k_pose_channel_slots = 16;
+
+// Clients stop writing when the driver's heartbeat is older than this
+inline constexpr std::int64_t k_pose_channel_heartbeat_timeout_us = 500'000;
+
+enum PoseChannelFlags : std::uint32_t
+{
+    PoseFlag_TrackingState = 1 << 0,
+    PoseFlag_HasVelocity = 1 << 1,
+    PoseFlag_HasAngularVelocity = 1 << 2,
+    PoseFlag_HasAcceleration = 1 << 3,
+    PoseFlag_HasAngularAcceleration = 1 << 4
+};
+
+// Pose payload, mirrored by the client (plugin_OpenVR/Utils/PoseChannel.cs)
+struct PoseChannelSample
+{
+    std::int64_t timestamp; // Capture time: steady clock (QPC) microseconds, 0 if unknown
+    std::uint32_t flags;
+    float position[3];
+    float orientation[4]; // x, y, z, w
+    float velocity[3];
+    float acceleration[3];
+    float angular_velocity[3];
+    float angular_acceleration[3];
+};
+
+struct alignas(64) PoseChannelHeader
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t slot_count;
+    std::uint32_t slot_size;
+    std::atomic<std::int64_t> heartbeat; // Steady clock microseconds, 0 once the driver closed the channel
+};
+
+struct PoseChannelLayout
+{
+    PoseChannelHeader header;
+    Util::seqlock<PoseChannelSample> slots[k_pose_channel_slots];
+};
+
+static_assert(std::atomic<std::int64_t>::is_always_lock_free, "The heartbeat is shared between processes");
+static_assert(offsetof(PoseChannelHeader, heartbeat) == 16, "Mirrored by the client");
+static_assert(sizeof(Util::seqlock<PoseChannelSample>) == 128, "Two cache lines per slot");
+static_assert(offsetof(PoseChannelLayout, slots) == 64, "Slots start right after the header");
+
+class PoseChannel
+{
+public:
+    PoseChannel() = default;
+    ~PoseChannel() { close(); }
+
+    PoseChannel(const PoseChannel&) = delete;
+    PoseChannel& operator=(const PoseChannel&) = delete;
+
+    // Create (or attach to) the shared region and initialize its header
+    bool open(const wchar_t* name = k_pose_channel_name);
+    void close();
+
+    [[nodiscard]] bool is_open() const { return layout_ != nullptr; }
+
+    // Tell clients the driver is still reading (once per frame)
+    void beat(std::int64_t now_us);
+
+    // Fetch the slot's sample if it changed since the last successful read.
+    // Never blocks: a slot that's being written is picked up next frame.
+    bool try_read(std::size_t slot, PoseChannelSample& sample);
+
+private:
+    void* mapping_ = nullptr;
+    PoseChannelLayout* layout_ = nullptr;
+    std::uint32_t last_versions_[k_pose_channel_slots] = {};
+};
@@ -0,0 +1,147 @@
+#pragma once
+#include <cmath>
+#include <openvr_driver.h>
+
+// Derives linear and angular velocity from successive timestamped poses,
+// used when the sender doesn't provide its own derivatives.
+// Not thread-safe: feed it from one thread at a time (BodyTracker::apply_pose).
+class PoseEstimator
+{
+public:
+    /**
+     * \brief Create an estimator
+     * \param smoothing Exponential smoothing factor in [0, 1), 0 = raw finite differences
+     */
+    explicit PoseEstimator(const double smoothing = 0.5) : smoothing_(smoothing)
+    {
+    }
+
+    // Forget the history, e.g. after tracking loss
+    void reset()
+    {
+        has_sample_ = false;
+        has_estimate_ = false;
+    }
+
+    /**
+     * \brief Feed a new sample and compute the current estimate
+     * \param position Sample position in meters
+     * \param rotation Sample orientation
+     * \param time Sample time in seconds
+     * \param velocity Estimated linear velocity in m/s (world space)
+     * \param angular_velocity Estimated angular velocity in rad/s (device space)
+     */
+    void update(const double (&position)[3], const vr::HmdQuaternion_t& rotation,
+                const double time, double (&velocity)[3], double (&angular_velocity)[3])
+    {
+        const auto dt = time - last_time_;
+
+        // Too close to the last sample to differentiate, keep the estimate
+        if (has_sample_ && dt >= 0.0 && dt < min_dt)
+        {
+            copy_out(velocity, angular_velocity);
+            return;
+        }
+
+        // First sample, or a gap too large to differentiate over
+        if (!has_sample_ || dt < 0.0 || dt > max_dt)
+        {
+            has_estimate_ = false;
+            store(position, rotation, time);
+
+            for (auto i = 0; i < 3; i++)
+                velocity_[i] = angular_velocity_[i] = 0.0;
+
+            copy_out(velocity, angular_velocity);
+            return;
+        }
+
+        // Linear: finite differences
+        double raw_velocity[3];
+        for (auto i = 0; i < 3; i++)
+            raw_velocity[i] = (position[i] - last_position_[i]) / dt;
+
+        // Angular: log map of the delta rotation (last^-1 * current)
+        double raw_angular[3];
+        log_map(delta(last_rotation_, rotation), dt, raw_angular);
+
+        // Exponential smoothing, skipped for the very first estimate
+        const auto alpha = has_estimate_ ? smoothing_ : 0.0;
+        for (auto i = 0; i < 3; i++)
+        {
+            velocity_[i] = alpha * velocity_[i] + (1.0 - alpha) * raw_velocity[i];
+            angular_velocity_[i] = alpha * angular_velocity_[i] + (1.0 - alpha) * raw_angular[i];
+        }
+
+        has_estimate_ = true;
+        store(position, rotation, time);
+        copy_out(velocity, angular_velocity);
+    }
+
+    // Samples closer than this are skipped, further apart reset the estimate
+    static constexpr double min_dt = 0.001, max_dt = 0.25;
+
+private:
+    static vr::HmdQuaternion_t delta(const vr::HmdQuaternion_t& from, const vr::HmdQuaternion_t& to)
+    {
+        // conj(from) * to
+        return {
+            from.w * to.w + from.x * to.x + from.y * to.y + from.z * to.z,
+            from.w * to.x - from.x * to.w - from.y * to.z + from.z * to.y,
+            from.w * to.y + from.x * to.z - from.y * to.w - from.z * to.x,
+            from.w * to.z - from.x * to.y + from.y * to.x - from.z * to.w
+        };
+    }
+
+    static void log_map(vr::HmdQuaternion_t q, const double dt, double (&out)[3])
+    {
+        // Take the shortest arc
+        if (q.w < 0.0)
+        {
+            q.w = -q.w;
+            q.x = -q.x;
+            q.y = -q.y;
+            q.z = -q.z;
+        }
+
+        const auto sin_half = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+
+        // angle / sin(angle / 2), approaching 2 for tiny rotations
+        const auto scale = sin_half > 1e-9
+                               ? 2.0 * std::atan2(sin_half, q.w) / sin_half
+                               : 2.0 / (q.w > 0.0 ? q.w : 1.0);
+
+        out[0] = q.x * scale / dt;
+        out[1] = q.y * scale / dt;
+        out[2] = q.z * scale / dt;
+    }
+
+    void store(const double (&position)[3], const vr::HmdQuaternion_t& rotation, const double time)
+    {
+        for (auto i = 0; i < 3; i++)
+            last_position_[i] = position[i];
+
+        last_rotation_ = rotation;
+        last_time_ = time;
+        has_sample_ = true;
+    }
+
+    void copy_out(double (&velocity)[3], double (&angular_velocity)[3]) const
+    {
+        for (auto i = 0; i < 3; i++)
+        {
+            velocity[i] = velocity_[i];
+            angular_velocity[i] = angular_velocity_[i];
+        }
+    }
+
+    double smoothing_;
+    bool has_sample_ = false, has_estimate_ = false;
+
+    double last_position_[3] = {0, 0, 0};
+    vr::HmdQuaternion_t last_rotation_ = {1, 0, 0, 0};
+    double last_time_ = 0.0;
+
+    double velocity_[3] = {0, 0, 0};
+    double angular_velocity_[3] = {0, 0, 0};
+};
@@ -0,0 +1,128 @@
+#pragma once
+#include <cmath>
+#include <numbers>
+#include <tuple>
+#include <utility>
+#include <openvr_driver.h>
+
+#include "PoseHistory.h"
+
+// One pose as seen by the filter stages, filtered in place
+struct PoseFilterSample
+{
+    double position[3];
+    vr::HmdQuaternion_t rotation;
+    double time; // Seconds
+};
+
+struct OneEuroParams
+{
+    double min_cutoff = 1.0; // Hz, smoothing at rest (lower = smoother)
+    double beta = 0.5; // Speed coefficient (higher = less lag when moving)
+    double d_cutoff = 1.0; // Hz, smoothing of the speed estimate
+};
+
+// One-Euro filter (Casiez et al.) on position, with a quaternion variant for rotation:
+// the cutoff rises with the (smoothed) speed, so jitter is removed at rest without lagging fast motion.
+class OneEuroPoseFilter
+{
+public:
+    OneEuroPoseFilter() = default;
+
+    explicit OneEuroPoseFilter(const OneEuroParams& position, const OneEuroParams& rotation) :
+        position_params_(position), rotation_params_(rotation)
+    {
+    }
+
+    void reset()
+    {
+        has_sample_ = false;
+    }
+
+    void apply(PoseFilterSample& sample)
+    {
+        const auto dt = sample.time - last_time_;
+        if (!has_sample_ || dt <= 0.0 || dt > max_dt)
+        {
+            // (Re)start from the current sample
+            for (auto i = 0; i < 3; i++)
+                position_[i] = sample.position[i];
+
+            rotation_ = sample.rotation;
+            speed_ = angular_speed_ = 0.0;
+            last_time_ = sample.time;
+            has_sample_ = true;
+            return;
+        }
+
+        // Position: one cutoff for all axes, driven by the linear speed
+        double delta[3], distance = 0.0;
+        for (auto i = 0; i < 3; i++)
+        {
+            delta[i] = sample.position[i] - position_[i];
+            distance += delta[i] * delta[i];
+        }
+
+        speed_ += alpha(position_params_.d_cutoff, dt) * (std::sqrt(distance) / dt - speed_);
+        const auto position_alpha = alpha(position_params_.min_cutoff + position_params_.beta * speed_, dt);
+
+        for (auto i = 0; i < 3; i++)
+            sample.position[i] = position_[i] += position_alpha * delta[i];
+
+        // Rotation: same on the angle to the last output, blended with slerp
+        const auto dot = std::abs(rotation_.w * sample.rotation.w + rotation_.x * sample.rotation.x +
+            rotation_.y * sample.rotation.y + rotation_.z * sample.rotation.z);
+        const auto angle = 2.0 * std::acos(std::fmin(dot, 1.0));
+
+        angular_speed_ += alpha(rotation_params_.d_cutoff, dt) * (angle / dt - angular_speed_);
+        const auto rotation_alpha = alpha(rotation_params_.min_cutoff + rotation_params_.beta * angular_speed_, dt);
+
+        sample.rotation = rotation_ = PoseHistory::slerp(rotation_, sample.rotation, rotation_alpha);
+        last_time_ = sample.time;
+    }
+
+    // Gaps longer than this restart the filter
+    static constexpr double max_dt = 0.25;
+
+private:
+    static double alpha(const double cutoff, const double dt)
+    {
+        const auto tau = 1.0 / (2.0 * std::numbers::pi * cutoff);
+        return 1.0 / (1.0 + tau / dt);
+    }
+
+    OneEuroParams position_params_, rotation_params_;
+
+    bool has_sample_ = false;
+    double last_time_ = 0.0;
+
+    double position_[3] = {0, 0, 0};
+    vr::HmdQuaternion_t rotation_ = {1, 0, 0, 0};
+    double speed_ = 0.0, angular_speed_ = 0.0;
+};
+
+// Filter stages applied in order, resolved at compile time (no allocation, no virtual calls).
+// A stage is anything with reset() and apply(PoseFilterSample&).
+template <typename... Stages>
+class PoseFilterChain
+{
+public:
+    PoseFilterChain() = default;
+
+    explicit PoseFilterChain(Stages... stages) : stages_(std::move(stages)...)
+    {
+    }
+
+    void reset()
+    {
+        std::apply([](auto&... stage) { (stage.reset(), ...); }, stages_);
+    }
+
+    void apply(PoseFilterSample& sample)
+    {
+        std::apply([&](auto&... stage) { (stage.apply(sample), ...); }, stages_);
+    }
+
+private:
+    std::tuple<Stages...> stages_;
+};
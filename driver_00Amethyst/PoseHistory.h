@@ -0,0 +1,134 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <openvr_driver.h>
+
+// One received pose, as kept in PoseHistory
+struct PoseHistorySample
+{
+    double position[3];
+    vr::HmdQuaternion_t rotation;
+    double velocity[3];
+    bool has_velocity; // Sent by the source (used for Hermite interpolation)
+    long long timestamp; // Steady clock microseconds
+};
+
+// Small jitter buffer of the latest timestamped samples, sampled at an arbitrary time.
+// Plain data, published together with the pose (see TrackerPoseState).
+class PoseHistory
+{
+public:
+    static constexpr std::uint32_t capacity = 4;
+
+    void clear()
+    {
+        count_ = 0;
+    }
+
+    // Add a sample, older or same-time samples replace the history
+    void push(const PoseHistorySample& sample)
+    {
+        if (count_ > 0 && sample.timestamp <= newest().timestamp) count_ = 0;
+
+        head_ = (head_ + 1) % capacity;
+        samples_[head_] = sample;
+        if (count_ < capacity) count_++;
+    }
+
+    [[nodiscard]] bool empty() const { return count_ == 0; }
+
+    [[nodiscard]] const PoseHistorySample& newest() const { return samples_[head_]; }
+
+    /**
+     * \brief Sample the history at the given time
+     * \param time Steady clock microseconds, clamped to the buffered range (no extrapolation)
+     * \param out Interpolated position, rotation and velocity
+     * \return false if the history is empty
+     */
+    bool sample(const long long time, PoseHistorySample& out) const
+    {
+        if (count_ == 0) return false;
+
+        // Walk back from the newest sample to the pair surrounding the time
+        for (std::uint32_t i = 0; i + 1 < count_; i++)
+        {
+            const auto& later = at(i);
+            const auto& earlier = at(i + 1);
+            if (time > later.timestamp) break; // After the newest one
+            if (time < earlier.timestamp) continue;
+
+            interpolate(earlier, later, time, out);
+            return true;
+        }
+
+        // Clamp to the closest end of the history
+        out = time < at(count_ - 1).timestamp ? at(count_ - 1) : newest();
+        return true;
+    }
+
+    // Spherical interpolation along the shortest arc, u in [0, 1]
+    static vr::HmdQuaternion_t slerp(const vr::HmdQuaternion_t& a, vr::HmdQuaternion_t b, const double u)
+    {
+        // Take the shortest arc
+        auto dot = a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z;
+        if (dot < 0.0)
+        {
+            b = {-b.w, -b.x, -b.y, -b.z};
+            dot = -dot;
+        }
+
+        // Nearly parallel: normalized lerp is accurate and avoids dividing by ~0
+        double wa = 1.0 - u, wb = u;
+        if (dot < 0.9995)
+        {
+            const auto theta = std::acos(dot);
+            const auto sin_theta = std::sin(theta);
+            wa = std::sin((1.0 - u) * theta) / sin_theta;
+            wb = std::sin(u * theta) / sin_theta;
+        }
+
+        vr::HmdQuaternion_t result{
+            wa * a.w + wb * b.w, wa * a.x + wb * b.x, wa * a.y + wb * b.y, wa * a.z + wb * b.z
+        };
+
+        const auto norm = std::sqrt(result.w * result.w + result.x * result.x +
+            result.y * result.y + result.z * result.z);
+        return {result.w / norm, result.x / norm, result.y / norm, result.z / norm};
+    }
+
+private:
+    // i-th newest sample, 0 being the newest
+    [[nodiscard]] const PoseHistorySample& at(const std::uint32_t i) const
+    {
+        return samples_[(head_ + capacity - i) % capacity];
+    }
+
+    static void interpolate(const PoseHistorySample& a, const PoseHistorySample& b,
+                            const long long time, PoseHistorySample& out)
+    {
+        const auto dt = static_cast<double>(b.timestamp - a.timestamp) / 1e6;
+        const auto u = static_cast<double>(time - a.timestamp) / static_cast<double>(b.timestamp - a.timestamp);
+
+        // Cubic Hermite if both ends have real velocities, linear otherwise
+        const auto hermite = a.has_velocity && b.has_velocity;
+        const auto u2 = u * u, u3 = u2 * u;
+        const auto h00 = 2 * u3 - 3 * u2 + 1, h10 = u3 - 2 * u2 + u,
+                   h01 = -2 * u3 + 3 * u2, h11 = u3 - u2;
+
+        for (auto i = 0; i < 3; i++)
+        {
+            out.position[i] = hermite
+                                  ? h00 * a.position[i] + h10 * dt * a.velocity[i] +
+                                  h01 * b.position[i] + h11 * dt * b.velocity[i]
+                                  : a.position[i] + (b.position[i] - a.position[i]) * u;
+            out.velocity[i] = a.velocity[i] + (b.velocity[i] - a.velocity[i]) * u;
+        }
+
+        out.rotation = slerp(a.rotation, b.rotation, u);
+        out.has_velocity = hermite;
+        out.timestamp = time;
+    }
+
+    PoseHistorySample samples_[capacity] = {};
+    std::uint32_t head_ = 0, count_ = 0;
+};
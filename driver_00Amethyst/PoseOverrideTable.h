@@ -0,0 +1,54 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <openvr_driver.h>
+
+#include "DataContract.h"
+#include "util/seqlock.hpp"
+
+// Fixed-size table of pose overrides indexed by OpenVR device ID.
+// Written from the COM thread, read from the TrackedDevicePoseUpdated detours:
+// the common (no override) case is a single relaxed bit test.
+class PoseOverrideTable
+{
+public:
+    static constexpr uint32_t size = vr::k_unMaxTrackedDeviceCount;
+
+    [[nodiscard]] bool enabled(const uint32_t id) const
+    {
+        return id < size && (mask_[id / 64].load(std::memory_order_relaxed) >> (id % 64) & 1);
+    }
+
+    void set_enabled(const uint32_t id, const bool is_enabled)
+    {
+        if (id >= size) return;
+
+        const auto bit = 1ull << (id % 64);
+        if (is_enabled)
+        {
+            // Start from an empty (invalid) pose, like before
+            poses_[id].store(dDriverPose{});
+            mask_[id / 64].fetch_or(bit, std::memory_order_release);
+        }
+        else mask_[id / 64].fetch_and(~bit, std::memory_order_release);
+    }
+
+    // Update the override pose, ignored if not enabled
+    void set_pose(const uint32_t id, const dDriverPose& pose)
+    {
+        if (enabled(id)) poses_[id].store(pose);
+    }
+
+    // Get the override pose if enabled (retries only while a write is in flight)
+    bool try_get(const uint32_t id, dDriverPose& pose) const
+    {
+        if (!enabled(id)) return false;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        pose = poses_[id].load();
+        return true;
+    }
+
+private:
+    std::atomic<uint64_t> mask_[(size + 63) / 64] = {};
+    Util::seqlock<dDriverPose> poses_[size];
+};
@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+
+#include "DataContract.h"
+
+// dPoseSample is copied as one block by the proxy/stub and mirrored by the client (tlbimp),
+// so its layout is part of the interface: 88 bytes, the timestamp 8-aligned after 4 bytes of padding
+static_assert(sizeof(dPoseSample) == 88);
+static_assert(offsetof(dPoseSample, Flags) == 1);
+static_assert(offsetof(dPoseSample, Position) == 4);
+static_assert(offsetof(dPoseSample, Orientation) == 16);
+static_assert(offsetof(dPoseSample, Velocity) == 32);
+static_assert(offsetof(dPoseSample, Acceleration) == 44);
+static_assert(offsetof(dPoseSample, AngularVelocity) == 56);
+static_assert(offsetof(dPoseSample, AngularAcceleration) == 68);
+static_assert(offsetof(dPoseSample, Timestamp) == 80);
+
+// Expand a compact pose (UpdateTrackerCompact, SubmitTrackerPoses), the role isn't validated here
+inline dTrackerBase expand_pose_sample(const dPoseSample& pose)
+{
+    const auto has = [&](const int flag) { return static_cast<boolean>((pose.Flags & flag) != 0); };
+    return dTrackerBase{
+        .ConnectionState = true,
+        .TrackingState = has(PoseSample_Tracked),
+        .Serial = nullptr, // Not used for pose updates
+        .Role = static_cast<dTrackerType>(pose.Role),
+        .Position = pose.Position,
+        .Orientation = pose.Orientation,
+        .Velocity = {has(PoseSample_HasVelocity), pose.Velocity},
+        .Acceleration = {has(PoseSample_HasAcceleration), pose.Acceleration},
+        .AngularVelocity = {has(PoseSample_HasAngularVelocity), pose.AngularVelocity},
+        .AngularAcceleration = {has(PoseSample_HasAngularAcceleration), pose.AngularAcceleration},
+        .Timestamp = pose.Timestamp
+    };
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+
+// What a tracker last submitted to the runtime, to skip resubmitting unchanged poses.
+// Not thread-safe: RunFrame thread only (BodyTracker::update).
+class PoseSubmission
+{
+public:
+    // Submit on the next frame whatever changed, e.g. after Activate
+    void reset()
+    {
+        submitted_at_ = 0;
+    }
+
+    /**
+     * \brief Decide whether to submit this frame, remembered if so
+     * \param version Version of the pose to submit (its seqlock version)
+     * \param world_version Version of the playspace transform
+     * \param active Connection state to submit
+     * \param moving The output changes every frame anyway (interpolating between samples)
+     * \param now Steady clock microseconds
+     * \param keep_alive_us Unchanged poses are still resubmitted this often
+     */
+    bool should_submit(const std::uint32_t version, const std::uint32_t world_version, const bool active,
+                       const bool moving, const long long now, const long long keep_alive_us)
+    {
+        // Skip if neither the pose, the state nor the playspace changed, unless it's time for a keep-alive
+        if (submitted_at_ > 0 && version == version_ && world_version == world_version_ &&
+            active == active_ && !moving && now - submitted_at_ < keep_alive_us)
+            return false;
+
+        version_ = version;
+        world_version_ = world_version;
+        active_ = active;
+        submitted_at_ = now;
+        return true;
+    }
+
+    // Steady clock microseconds of the last submission, 0 = not yet
+    [[nodiscard]] long long submitted_at() const
+    {
+        return submitted_at_;
+    }
+
+private:
+    std::uint32_t version_ = 0, world_version_ = 0;
+    bool active_ = false;
+    long long submitted_at_ = 0;
+};
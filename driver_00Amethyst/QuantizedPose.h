@@ -0,0 +1,212 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+
+// F16C half conversion, picked at runtime (the driver targets baseline x64)
+#if defined(_M_X64) || defined(__x86_64__)
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define AME_TARGET_F16C
+#else
+#define AME_TARGET_F16C __attribute__((target("f16c")))
+#endif
+#define AME_QUANTIZED_POSE_F16C
+#endif
+
+#include "DataContract.h"
+
+// dQuantizedPose layout (see DataContract.idl):
+//  - Flags: dPoseSampleFlags in the low bits, the dropped quaternion component (x, y, z, w) in bits 5-6
+//  - Position: millimetres from the batch origin, +-32.767m (error <= 0.5mm)
+//  - Rotation: smallest three, the others mapped from [-1/sqrt2, 1/sqrt2] to 16 bits (error < 0.01deg)
+//  - Derivatives: IEEE half floats (relative error <= 2^-11)
+inline constexpr std::uint8_t k_quantized_rotation_shift = 5;
+inline constexpr std::uint8_t k_quantized_flags_mask = (1 << k_quantized_rotation_shift) - 1;
+
+inline float half_to_float(const std::uint16_t half)
+{
+    const auto sign = static_cast<std::uint32_t>(half & 0x8000) << 16;
+    const auto exponent = (half >> 10) & 0x1F;
+    const auto mantissa = static_cast<std::uint32_t>(half & 0x3FF);
+
+    if (exponent == 0) // Zero or subnormal
+    {
+        const auto magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -magnitude : magnitude;
+    }
+    if (exponent == 31) // Inf or NaN
+        return std::bit_cast<float>(sign | 0x7F800000 | mantissa << 13);
+
+    return std::bit_cast<float>(sign | static_cast<std::uint32_t>(exponent + 112) << 23 | mantissa << 13);
+}
+
+// Round to nearest even, out of range values become infinities
+inline std::uint16_t float_to_half(const float value)
+{
+    auto bits = std::bit_cast<std::uint32_t>(value);
+    const auto sign = static_cast<std::uint16_t>(bits >> 16 & 0x8000);
+    bits &= 0x7FFFFFFF;
+
+    if (bits > 0x7F800000) return sign | 0x7E00; // NaN
+    if (bits >= 0x477FF000) return sign | 0x7C00; // Overflow (incl. inf)
+    if (bits < 0x38800000) // Below the smallest normal half: subnormal steps of 2^-24
+        return sign | static_cast<std::uint16_t>(std::nearbyint(std::bit_cast<float>(bits) * 16777216.f));
+
+    bits += 0xC8000FFF + (bits >> 13 & 1); // Rebias the exponent (-112) and round
+    return sign | static_cast<std::uint16_t>(bits >> 13);
+}
+
+inline void decode_halves_scalar(const std::uint16_t* halves, float* values, const std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+        values[i] = half_to_float(halves[i]);
+}
+
+#ifdef AME_QUANTIZED_POSE_F16C
+// F16C is VEX-encoded: it needs the CPU feature and the OS saving the AVX state
+inline bool cpu_supports_f16c()
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 1);
+    constexpr int osxsave = 1 << 27, avx = 1 << 28, f16c = 1 << 29;
+    return (info[2] & (osxsave | avx | f16c)) == (osxsave | avx | f16c) && (_xgetbv(0) & 6) == 6;
+#else
+    return __builtin_cpu_supports("f16c"); // Checks the OS support too
+#endif
+}
+
+inline const bool g_cpu_supports_f16c = cpu_supports_f16c();
+
+// 4 halves per instruction, only call when g_cpu_supports_f16c
+AME_TARGET_F16C inline void decode_halves_f16c(const std::uint16_t* halves, float* values, const std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(values + i, _mm_cvtph_ps(
+                          _mm_loadl_epi64(reinterpret_cast<const __m128i*>(halves + i))));
+
+    decode_halves_scalar(halves + i, values + i, count - i);
+}
+#endif
+
+// Expand half floats, with F16C when the CPU has it
+inline void decode_halves(const std::uint16_t* halves, float* values, const std::size_t count)
+{
+#ifdef AME_QUANTIZED_POSE_F16C
+    if (g_cpu_supports_f16c) return decode_halves_f16c(halves, values, count);
+#endif
+    decode_halves_scalar(halves, values, count);
+}
+
+/**
+ * \brief Pack a unit quaternion (x, y, z, w) as its three smallest components
+ * \return Index of the dropped (largest) component, stored in Flags
+ */
+inline std::uint8_t encode_rotation(const float (&q)[4], std::uint16_t (&out)[3])
+{
+    std::uint8_t largest = 0;
+    for (std::uint8_t i = 1; i < 4; i++)
+        if (std::abs(q[i]) > std::abs(q[largest])) largest = i;
+
+    // q and -q are the same rotation: keep the dropped one positive
+    const auto sign = q[largest] < 0.f ? -1.f : 1.f;
+    for (std::uint8_t i = 0, j = 0; i < 4; i++)
+    {
+        if (i == largest) continue;
+        const auto unit = (sign * q[i] * std::numbers::sqrt2_v<float> + 1.f) * 0.5f; // [0, 1]
+        out[j++] = static_cast<std::uint16_t>(std::lround(std::clamp(unit, 0.f, 1.f) * 65535.f));
+    }
+
+    return largest;
+}
+
+inline void decode_rotation(const std::uint16_t (&in)[3], const std::uint8_t largest, float (&q)[4])
+{
+    auto sum = 0.f;
+    for (std::uint8_t i = 0, j = 0; i < 4; i++)
+    {
+        if (i == largest) continue;
+        q[i] = (static_cast<float>(in[j++]) / 65535.f * 2.f - 1.f) / std::numbers::sqrt2_v<float>;
+        sum += q[i] * q[i];
+    }
+
+    q[largest] = std::sqrt(std::max(0.f, 1.f - sum));
+}
+
+// Expand one pose of a quantized batch (origin and capture time are per batch)
+inline dTrackerBase decode_quantized_pose(const dQuantizedPose& pose, const dVector3& origin, const long long timestamp)
+{
+    // All derivatives at once: Velocity, Acceleration, AngularVelocity and AngularAcceleration are contiguous
+    static_assert(offsetof(dQuantizedPose, AngularAcceleration) == offsetof(dQuantizedPose, Velocity) + 9 * 2);
+
+    float derivatives[12];
+    decode_halves(reinterpret_cast<const std::uint16_t*>(
+                      reinterpret_cast<const unsigned char*>(&pose) + offsetof(dQuantizedPose, Velocity)),
+                  derivatives, 12);
+
+    float q[4];
+    decode_rotation(pose.Rotation, static_cast<std::uint8_t>(pose.Flags >> k_quantized_rotation_shift & 3), q);
+
+    const auto flags = pose.Flags & k_quantized_flags_mask;
+    const auto vector = [&](const int flag, const float* v)
+    {
+        return dVector3Nullable{static_cast<boolean>((flags & flag) != 0), {v[0], v[1], v[2]}};
+    };
+
+    return dTrackerBase{
+        .ConnectionState = true,
+        .TrackingState = static_cast<boolean>((flags & PoseSample_Tracked) != 0),
+        .Serial = nullptr,
+        .Role = static_cast<dTrackerType>(pose.Role),
+        .Position = {
+            origin.X + pose.Position[0] / 1000.f,
+            origin.Y + pose.Position[1] / 1000.f,
+            origin.Z + pose.Position[2] / 1000.f
+        },
+        .Orientation = {q[0], q[1], q[2], q[3]},
+        .Velocity = vector(PoseSample_HasVelocity, derivatives),
+        .Acceleration = vector(PoseSample_HasAcceleration, derivatives + 3),
+        .AngularVelocity = vector(PoseSample_HasAngularVelocity, derivatives + 6),
+        .AngularAcceleration = vector(PoseSample_HasAngularAcceleration, derivatives + 9),
+        .Timestamp = timestamp
+    };
+}
+
+// Reference encoder, positions are clamped to the representable range
+inline dQuantizedPose encode_quantized_pose(const dTrackerBase& tracker, const dVector3& origin)
+{
+    dQuantizedPose pose{};
+    pose.Role = static_cast<unsigned char>(tracker.Role);
+
+    const float position[3] = {tracker.Position.X - origin.X, tracker.Position.Y - origin.Y,
+                               tracker.Position.Z - origin.Z};
+    for (auto i = 0; i < 3; i++)
+        pose.Position[i] = static_cast<short>(std::lround(std::clamp(position[i] * 1000.f, -32767.f, 32767.f)));
+
+    const float q[4] = {tracker.Orientation.X, tracker.Orientation.Y, tracker.Orientation.Z, tracker.Orientation.W};
+    const auto largest = encode_rotation(q, pose.Rotation);
+
+    const auto pack = [](const dVector3Nullable& v, unsigned short (&out)[3], const int flag)
+    {
+        out[0] = float_to_half(v.Value.X);
+        out[1] = float_to_half(v.Value.Y);
+        out[2] = float_to_half(v.Value.Z);
+        return v.HasValue ? flag : 0;
+    };
+
+    pose.Flags = static_cast<unsigned char>(
+        (tracker.TrackingState ? PoseSample_Tracked : 0) |
+        pack(tracker.Velocity, pose.Velocity, PoseSample_HasVelocity) |
+        pack(tracker.Acceleration, pose.Acceleration, PoseSample_HasAcceleration) |
+        pack(tracker.AngularVelocity, pose.AngularVelocity, PoseSample_HasAngularVelocity) |
+        pack(tracker.AngularAcceleration, pose.AngularAcceleration, PoseSample_HasAngularAcceleration) |
+        largest << k_quantized_rotation_shift);
+
+    return pose;
+}
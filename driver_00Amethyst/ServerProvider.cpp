@@ -16,6 +16,44 @@ vr::EVRInitError ServerProvider::Init(vr::IVRDriverContext* pDriverContext)
     // Use the driver context (sets up a big set of globals)
     VR_INIT_SERVER_DRIVER_CONTEXT(pDriverContext)
 
+    // Optional verbose logging ("driver_00Amethyst": {"verboseLogging": true} in vrsettings)
+    vr::EVRSettingsError settings_error = vr::VRSettingsError_None;
+    if (vr::VRSettings()->GetBool("driver_00Amethyst", "verboseLogging", &settings_error) &&
+        settings_error == vr::VRSettingsError_None)
+    {
+        g_log_level = LogLevel_Verbose;
+        logMessage(AME_LOG_VERBOSE
+                       ? "Verbose logging enabled."
+                       : "Verbose logging requested, but it's not compiled into this build.");
+    }
+
+    // Optional pose keep-alive interval ("driver_00Amethyst": {"poseKeepAliveMs": 50} in vrsettings)
+    settings_error = vr::VRSettingsError_None;
+    if (const auto keep_alive = vr::VRSettings()->GetInt32("driver_00Amethyst", "poseKeepAliveMs", &settings_error);
+        settings_error == vr::VRSettingsError_None && keep_alive > 0)
+    {
+        g_pose_keep_alive_us = keep_alive * 1000ll;
+        logMessage(std::format("Unchanged poses will be resubmitted every {}ms.", keep_alive));
+    }
+
+    // Optional pose interpolation delay ("driver_00Amethyst": {"poseInterpolationDelayMs": 40} in vrsettings)
+    settings_error = vr::VRSettingsError_None;
+    if (const auto delay = vr::VRSettings()->GetInt32("driver_00Amethyst", "poseInterpolationDelayMs", &settings_error);
+        settings_error == vr::VRSettingsError_None && delay > 0)
+    {
+        g_pose_interpolation_delay_us = delay * 1000ll;
+        logMessage(std::format("Tracker poses will be interpolated with a {}ms delay.", delay));
+    }
+
+    // Optional in-driver pose filter ("driver_00Amethyst": {"poseFilter": true} in vrsettings)
+    settings_error = vr::VRSettingsError_None;
+    if (vr::VRSettings()->GetBool("driver_00Amethyst", "poseFilter", &settings_error) &&
+        settings_error == vr::VRSettingsError_None)
+    {
+        g_pose_filter_enabled = true;
+        logMessage("In-driver pose filtering enabled.");
+    }
+
     logMessage("Setting up the server runner...");
     SetupService();
 
@@ -41,6 +79,10 @@ vr::EVRInitError ServerProvider::Init(vr::IVRDriverContext* pDriverContext)
     for (auto& tracker : tracker_vector_ | std::views::values)
         logMessage(std::format("Registered a tracker: ({})", tracker.get_serial()));
 
+    logMessage("Opening the shared pose channel...");
+    if (!pose_channel_.open())
+        logMessage("Pose channel unavailable, poses will be received through COM only.");
+
     logMessage("Injecting server driver hooks...");
     InjectHooks(this, pDriverContext);
 
@@ -88,6 +130,9 @@ vr::EVRInitError ServerProvider::Init(vr::IVRDriverContext* pDriverContext)
             return S_OK;
         });
 
+    // Start the background log writer (Init can't fail past this point)
+    g_driver_log.start();
+
     // That's all, mark as okay
     return vr::VRInitError_None;
 }
@@ -118,6 +163,7 @@ void ServerProvider::SetupService(const _GUID clsid)
             driver_service_ = winrt::make_self<DriverService>();
 
             driver_service_->TrackerVector(&tracker_vector_);
+            driver_service_->HapticEvents(&haptic_events_);
             driver_service_->RebuildCallback(this);
 
             InstallProxyStub();
@@ -193,6 +239,36 @@ void ServerProvider::Cleanup()
 {
     logMessage("Disabling server driver hooks...");
     DisableHooks();
+
+    logMessage("Closing the shared pose channel...");
+    pose_channel_.close();
+
+    // Dump sample latency stats for diagnostics
+    for (const auto& tracker : tracker_vector_ | std::views::values)
+    {
+        for (const auto transport : {PoseTransport_Com, PoseTransport_Channel})
+            if (const auto& latency = tracker.latency(transport); latency.count() > 0)
+                logMessage(std::format("Tracker ({}) sample latency via {}: p50 <= {}us, p99 <= {}us over {} samples",
+                                       tracker.get_serial(), transport == PoseTransport_Channel ? "shared memory" : "COM",
+                                       latency.percentile(0.5), latency.percentile(0.99), latency.count()));
+
+        if (const auto& applied = tracker.consumption_latency(); applied.count() > 0)
+            logMessage(std::format("Tracker ({}) applied latency: p50 <= {}us, p99 <= {}us over {} samples",
+                                   tracker.get_serial(), applied.percentile(0.5), applied.percentile(0.99),
+                                   applied.count()));
+    }
+
+    // Samples the client sent faster than frames consumed them
+    for (const auto& tracker : tracker_vector_ | std::views::values)
+        if (tracker.overwritten_samples() > 0)
+            logMessage(std::format("Tracker ({}) coalesced {} sample(s) that arrived within the same frame",
+                                   tracker.get_serial(), tracker.overwritten_samples()));
+
+    if (haptic_events_dropped_ > 0)
+        logMessage(std::format("Dropped {} haptic request(s), the client wasn't polling them", haptic_events_dropped_));
+
+    // Flush the log queue, anything logged later is written directly
+    g_driver_log.stop();
 }
 
 const char* const* ServerProvider::GetInterfaceVersions()
@@ -202,8 +278,87 @@ const char* const* ServerProvider::GetInterfaceVersions()
 
 void ServerProvider::RunFrame()
 {
+    ReadPoseChannel(); // Pick up shared memory poses
+    ProcessEvents(); // Queue haptic requests for the client
+
+    // One playspace snapshot per frame, a change applies to all trackers at once
+    uint32_t world_version;
+    const auto world = g_world_from_driver.load(&world_version);
+
     for (auto& tracker : tracker_vector_ | std::views::values)
-        tracker.update(); // Update all
+        tracker.update(world, world_version); // Update all
+}
+
+void ServerProvider::ReadPoseChannel()
+{
+    if (!pose_channel_.is_open()) return;
+    pose_channel_.beat(AME_API_GET_STEADY_TIMESTAMP_NOW);
+
+    PoseChannelSample sample;
+    for (std::size_t slot = 0; slot < k_pose_channel_slots; slot++)
+    {
+        if (!pose_channel_.try_read(slot, sample)) continue;
+
+        const dTrackerBase tracker{
+            .ConnectionState = true,
+            .TrackingState = (sample.flags & PoseFlag_TrackingState) != 0,
+            .Serial = nullptr,
+            .Role = static_cast<dTrackerType>(slot),
+            .Position = {sample.position[0], sample.position[1], sample.position[2]},
+            .Orientation = {sample.orientation[0], sample.orientation[1], sample.orientation[2], sample.orientation[3]},
+            .Velocity = {
+                (sample.flags & PoseFlag_HasVelocity) != 0,
+                {sample.velocity[0], sample.velocity[1], sample.velocity[2]}
+            },
+            .Acceleration = {
+                (sample.flags & PoseFlag_HasAcceleration) != 0,
+                {sample.acceleration[0], sample.acceleration[1], sample.acceleration[2]}
+            },
+            .AngularVelocity = {
+                (sample.flags & PoseFlag_HasAngularVelocity) != 0,
+                {sample.angular_velocity[0], sample.angular_velocity[1], sample.angular_velocity[2]}
+            },
+            .AngularAcceleration = {
+                (sample.flags & PoseFlag_HasAngularAcceleration) != 0,
+                {sample.angular_acceleration[0], sample.angular_acceleration[1], sample.angular_acceleration[2]}
+            },
+            .Timestamp = sample.timestamp
+        };
+
+        // HMD pose override, same as DriverService::UpdateTracker
+        if (tracker.Role == TrackerHead)
+        {
+            UpdateDriverPose(0, dDriverPose{
+                                 .ConnectionState = true,
+                                 .TrackingState = true,
+                                 .Position = tracker.Position,
+                                 .Orientation = tracker.Orientation
+                             });
+            continue;
+        }
+
+        if (tracker_vector_.contains(static_cast<ITrackerType>(tracker.Role)))
+            tracker_vector_.at(static_cast<ITrackerType>(tracker.Role)).set_pose(tracker, PoseTransport_Channel);
+    }
+}
+
+void ServerProvider::ProcessEvents()
+{
+    vr::VREvent_t event;
+    while (vr::VRServerDriverHost()->PollNextEvent(&event, sizeof event))
+    {
+        if (event.eventType != vr::VREvent_Input_HapticVibration) continue;
+
+        // Route the request to the device that owns the haptic component
+        dHapticEvent haptic;
+        for (const auto& tracker : tracker_vector_ | std::views::values)
+        {
+            if (!tracker.process_event(event, haptic)) continue;
+            if (!haptic_events_.try_push([&](dHapticEvent& slot) { slot = haptic; }))
+                haptic_events_dropped_++; // Nobody's polling
+            break;
+        }
+    }
 }
 
 bool ServerProvider::ShouldBlockStandbyMode()
@@ -222,22 +377,31 @@ void ServerProvider::LeaveStandby()
 bool ServerProvider::HandleDevicePoseUpdated(uint32_t openVRID, vr::DriverPose_t& pose)
 {
     // Apply pose overrides for selected IDs
-    if (pose_overrides_.contains(openVRID))
+    dDriverPose override_pose;
+    if (pose_overrides_.try_get(openVRID, override_pose))
     {
+        // Overrides are sent in the client's driver space (like tracker poses, see g_world_from_driver),
+        // the device keeps its own world from driver transform: re-express them in the latter
+        const auto to_device = device_from_client(g_world_from_driver.load(), {
+                                                      .rotation = pose.qWorldFromDriverRotation,
+                                                      .translation = {
+                                                          pose.vecWorldFromDriverTranslation[0],
+                                                          pose.vecWorldFromDriverTranslation[1],
+                                                          pose.vecWorldFromDriverTranslation[2]
+                                                      }
+                                                  });
+
         if (openVRID != 0)
-        {
-            pose.qRotation.w = pose_overrides_[openVRID].Orientation.W;
-            pose.qRotation.x = pose_overrides_[openVRID].Orientation.X;
-            pose.qRotation.y = pose_overrides_[openVRID].Orientation.Y;
-            pose.qRotation.z = pose_overrides_[openVRID].Orientation.Z;
-        }
+            pose.qRotation = to_device.apply(vr::HmdQuaternion_t{
+                override_pose.Orientation.W, override_pose.Orientation.X,
+                override_pose.Orientation.Y, override_pose.Orientation.Z
+            });
 
-        pose.vecPosition[0] = pose_overrides_[openVRID].Position.X;
-        pose.vecPosition[1] = pose_overrides_[openVRID].Position.Y;
-        pose.vecPosition[2] = pose_overrides_[openVRID].Position.Z;
+        to_device.apply({override_pose.Position.X, override_pose.Position.Y, override_pose.Position.Z},
+                        pose.vecPosition);
 
-        pose.poseIsValid = pose_overrides_[openVRID].TrackingState;
-        pose.deviceIsConnected = pose_overrides_[openVRID].ConnectionState;
+        pose.poseIsValid = override_pose.TrackingState;
+        pose.deviceIsConnected = override_pose.ConnectionState;
     }
 
     return true;
@@ -245,15 +409,16 @@ bool ServerProvider::HandleDevicePoseUpdated(uint32_t openVRID, vr::DriverPose_t
 
 void ServerProvider::SetPoseOverride(uint32_t id, bool isEnabled)
 {
-    if (isEnabled) pose_overrides_[id] = dDriverPose();
-    else pose_overrides_.erase(id);
+    if (id >= PoseOverrideTable::size)
+        throw std::out_of_range(std::format("Device ID {} is out of range", id));
+
+    pose_overrides_.set_enabled(id, isEnabled);
     if (id == 0) m_is_head_override_active = isEnabled;
 }
 
 void ServerProvider::UpdateDriverPose(uint32_t id, dDriverPose pose)
 {
-    if (pose_overrides_.contains(id))
-        pose_overrides_[id] = pose;
+    pose_overrides_.set_pose(id, pose);
 }
 
 class DriverWatchdog : public vr::IVRWatchdogProvider
@@ -1,5 +1,7 @@
 #pragma once
 #include "DriverService.h"
+#include "PoseChannel.h"
+#include "PoseOverrideTable.h"
 #include <openvr_driver.h>
 
 #include <set>
@@ -11,7 +13,14 @@ class ServerProvider : public vr::IServerTrackedDeviceProvider, IRebuildCallback
 private:
     winrt::com_ptr<DriverService> driver_service_ = nullptr;
     std::map<ITrackerType, BodyTracker> tracker_vector_ = {};
-    std::map<uint32_t, dDriverPose> pose_overrides_;
+    PoseOverrideTable pose_overrides_;
+
+    // Optional shared-memory pose transport (bypasses COM)
+    PoseChannel pose_channel_;
+
+    // Haptic requests waiting for the client, dropped when full
+    HapticEventQueue haptic_events_;
+    uint64_t haptic_events_dropped_ = 0;
 
     std::counting_semaphore<1> driver_semaphore_{0};
     DWORD register_cookie_ = 0;
@@ -45,4 +54,8 @@ public:
     void SetPoseOverride(uint32_t id, bool isEnabled);
 
     void UpdateDriverPose(uint32_t id, dDriverPose pose);
+
+private:
+    void ReadPoseChannel();
+    void ProcessEvents();
 };
@@ -0,0 +1,90 @@
+#pragma once
+#include <openvr_driver.h>
+
+#include "util/seqlock.hpp"
+
+// Playspace (world from driver) transform stamped into every submitted pose:
+// world = rotation * driver + translation, rotation normalized
+struct WorldFromDriverTransform
+{
+    vr::HmdQuaternion_t rotation = {1, 0, 0, 0};
+    double translation[3] = {0, 0, 0};
+
+    // Transform a driver space position to world space
+    void apply(const double (&driver)[3], double (&world)[3]) const
+    {
+        rotate(rotation, driver, world);
+        for (auto i = 0; i < 3; i++)
+            world[i] += translation[i];
+    }
+
+    // Transform a driver space orientation to world space
+    [[nodiscard]] vr::HmdQuaternion_t apply(const vr::HmdQuaternion_t& driver) const
+    {
+        return multiply(rotation, driver);
+    }
+
+    // Driver from world: rotation^-1 * (world - translation)
+    [[nodiscard]] WorldFromDriverTransform inverse() const
+    {
+        WorldFromDriverTransform result;
+        result.rotation = {rotation.w, -rotation.x, -rotation.y, -rotation.z};
+
+        double rotated[3];
+        rotate(result.rotation, translation, rotated);
+        for (auto i = 0; i < 3; i++)
+            result.translation[i] = -rotated[i];
+
+        return result;
+    }
+
+    // This after 'first', i.e. this->apply(first.apply(x))
+    [[nodiscard]] WorldFromDriverTransform after(const WorldFromDriverTransform& first) const
+    {
+        WorldFromDriverTransform result;
+        result.rotation = multiply(rotation, first.rotation);
+        apply(first.translation, result.translation);
+        return result;
+    }
+
+private:
+    static vr::HmdQuaternion_t multiply(const vr::HmdQuaternion_t& a, const vr::HmdQuaternion_t& b)
+    {
+        return {
+            a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z,
+            a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+            a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+            a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w
+        };
+    }
+
+    // q * v * conj(q) for a unit q
+    static void rotate(const vr::HmdQuaternion_t& q, const double (&v)[3], double (&out)[3])
+    {
+        // t = 2 * (q.xyz x v), out = v + w * t + q.xyz x t
+        const double t[3] = {
+            2.0 * (q.y * v[2] - q.z * v[1]),
+            2.0 * (q.z * v[0] - q.x * v[2]),
+            2.0 * (q.x * v[1] - q.y * v[0])
+        };
+
+        out[0] = v[0] + q.w * t[0] + (q.y * t[2] - q.z * t[1]);
+        out[1] = v[1] + q.w * t[1] + (q.z * t[0] - q.x * t[2]);
+        out[2] = v[2] + q.w * t[2] + (q.x * t[1] - q.y * t[0]);
+    }
+};
+
+/**
+ * \brief Driver space of one device from the client's driver space
+ * \param client The client's transform (g_world_from_driver), poses it sends are in its driver space
+ * \param device The device's own transform, as in its vr::DriverPose_t
+ * \return Re-expresses a client pose so that the device ends up at the same world pose
+ */
+inline WorldFromDriverTransform device_from_client(const WorldFromDriverTransform& client,
+                                                   const WorldFromDriverTransform& device)
+{
+    return device.inverse().after(client);
+}
+
+// Set by the client (SetWorldFromDriverTransform), loaded once per frame so all trackers share it
+inline Util::seqlock<WorldFromDriverTransform> g_world_from_driver;
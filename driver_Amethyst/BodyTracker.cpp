@@ -7,53 +7,56 @@ BodyTracker::BodyTracker(const std::string& serial, const ITrackerType role)
     _role = static_cast<int>(role);
     _active = false;
 
-    _pose = { 0 };
-    _pose.poseIsValid = true; // Otherwise tracker may disappear
-    _pose.result = vr::TrackingResult_Running_OK;
-    _pose.deviceIsConnected = false;
+    vr::DriverPose_t pose = {0};
+    pose.poseIsValid = false; // Until the first pose is received
+    pose.result = vr::TrackingResult_Running_OK;
+    pose.deviceIsConnected = false;
 
     // OpenVR Space Calibration : done on client side
-    _pose.qWorldFromDriverRotation.w = 1;
-    _pose.qWorldFromDriverRotation.x = 0;
-    _pose.qWorldFromDriverRotation.y = 0;
-    _pose.qWorldFromDriverRotation.z = 0;
+    pose.qWorldFromDriverRotation.w = 1;
+    pose.qWorldFromDriverRotation.x = 0;
+    pose.qWorldFromDriverRotation.y = 0;
+    pose.qWorldFromDriverRotation.z = 0;
 
     // OpenVR Driver Calibration : done on client side
-    _pose.qDriverFromHeadRotation.w = 1;
-    _pose.qDriverFromHeadRotation.x = 0;
-    _pose.qDriverFromHeadRotation.y = 0;
-    _pose.qDriverFromHeadRotation.z = 0;
+    pose.qDriverFromHeadRotation.w = 1;
+    pose.qDriverFromHeadRotation.x = 0;
+    pose.qDriverFromHeadRotation.y = 0;
+    pose.qDriverFromHeadRotation.z = 0;
 
     // Position
-    _pose.vecPosition[0] = 0;
-    _pose.vecPosition[1] = 0;
-    _pose.vecPosition[2] = 0;
+    pose.vecPosition[0] = 0;
+    pose.vecPosition[1] = 0;
+    pose.vecPosition[2] = 0;
 
     // Rotation
-    _pose.qRotation.w = 1;
-    _pose.qRotation.x = 0;
-    _pose.qRotation.y = 0;
-    _pose.qRotation.z = 0;
+    pose.qRotation.w = 1;
+    pose.qRotation.x = 0;
+    pose.qRotation.y = 0;
+    pose.qRotation.z = 0;
 
     // Velocity
-    _pose.vecVelocity[0] = 0;
-    _pose.vecVelocity[1] = 0;
-    _pose.vecVelocity[2] = 0;
+    pose.vecVelocity[0] = 0;
+    pose.vecVelocity[1] = 0;
+    pose.vecVelocity[2] = 0;
 
     // Acceleration
-    _pose.vecAcceleration[0] = 0;
-    _pose.vecAcceleration[1] = 0;
-    _pose.vecAcceleration[2] = 0;
+    pose.vecAcceleration[0] = 0;
+    pose.vecAcceleration[1] = 0;
+    pose.vecAcceleration[2] = 0;
 
     // Angular Velocity
-    _pose.vecAngularVelocity[0] = 0;
-    _pose.vecAngularVelocity[1] = 0;
-    _pose.vecAngularVelocity[2] = 0;
+    pose.vecAngularVelocity[0] = 0;
+    pose.vecAngularVelocity[1] = 0;
+    pose.vecAngularVelocity[2] = 0;
 
     // Angular Acceleration
-    _pose.vecAngularAcceleration[0] = 0;
-    _pose.vecAngularAcceleration[1] = 0;
-    _pose.vecAngularAcceleration[2] = 0;
+    pose.vecAngularAcceleration[0] = 0;
+    pose.vecAngularAcceleration[1] = 0;
+    pose.vecAngularAcceleration[2] = 0;
+
+    // Publish the initial pose
+    _pose.store(pose);
 }
 
 std::string BodyTracker::get_serial() const
@@ -65,11 +68,13 @@ void BodyTracker::update()
 {
     if (_index != vr::k_unTrackedDeviceIndexInvalid && _activated)
     {
+        // Grab a consistent snapshot, set_pose may be writing concurrently
+        auto pose = _pose.load();
+
         // If _active is false, then disconnect the tracker
-        _pose.poseIsValid = _valid;
-        _pose.deviceIsConnected = _active;
+        pose.deviceIsConnected = _active;
 
-        vr::VRServerDriverHost()->TrackedDevicePoseUpdated(_index, _pose, sizeof _pose);
+        vr::VRServerDriverHost()->TrackedDevicePoseUpdated(_index, pose, sizeof pose);
     }
 }
 
@@ -77,81 +82,86 @@ bool BodyTracker::set_pose(dTrackerBase const& tracker)
 {
     try
     {
+        // Build the new pose aside and publish it at once
+        auto pose = _pose.load();
+
         // Position
-        _pose.vecPosition[0] = tracker.Position.X;
-        _pose.vecPosition[1] = tracker.Position.Y;
-        _pose.vecPosition[2] = tracker.Position.Z;
-        _valid = tracker.TrackingState;
+        pose.vecPosition[0] = tracker.Position.X;
+        pose.vecPosition[1] = tracker.Position.Y;
+        pose.vecPosition[2] = tracker.Position.Z;
+        pose.poseIsValid = tracker.TrackingState;
 
         // Rotation
-        _pose.qRotation.w = tracker.Orientation.W;
-        _pose.qRotation.x = tracker.Orientation.X;
-        _pose.qRotation.y = tracker.Orientation.Y;
-        _pose.qRotation.z = tracker.Orientation.Z;
+        pose.qRotation.w = tracker.Orientation.W;
+        pose.qRotation.x = tracker.Orientation.X;
+        pose.qRotation.y = tracker.Orientation.Y;
+        pose.qRotation.z = tracker.Orientation.Z;
 
         // If the sender defines its own velocity
         if (tracker.Velocity.HasValue)
         {
             // Velocity
-            _pose.vecVelocity[0] = tracker.Velocity.Value.X;
-            _pose.vecVelocity[1] = tracker.Velocity.Value.Y;
-            _pose.vecVelocity[2] = tracker.Velocity.Value.Z;
+            pose.vecVelocity[0] = tracker.Velocity.Value.X;
+            pose.vecVelocity[1] = tracker.Velocity.Value.Y;
+            pose.vecVelocity[2] = tracker.Velocity.Value.Z;
         }
         else
         {
             // Velocity
-            _pose.vecVelocity[0] = 0.;
-            _pose.vecVelocity[1] = 0.;
-            _pose.vecVelocity[2] = 0.;
+            pose.vecVelocity[0] = 0.;
+            pose.vecVelocity[1] = 0.;
+            pose.vecVelocity[2] = 0.;
         }
 
         // If the sender defines its own acceleration
         if (tracker.Acceleration.HasValue)
         {
             // Acceleration
-            _pose.vecAcceleration[0] = tracker.Acceleration.Value.X;
-            _pose.vecAcceleration[1] = tracker.Acceleration.Value.Y;
-            _pose.vecAcceleration[2] = tracker.Acceleration.Value.Z;
+            pose.vecAcceleration[0] = tracker.Acceleration.Value.X;
+            pose.vecAcceleration[1] = tracker.Acceleration.Value.Y;
+            pose.vecAcceleration[2] = tracker.Acceleration.Value.Z;
         }
         else
         {
             // Acceleration
-            _pose.vecAcceleration[0] = 0.;
-            _pose.vecAcceleration[1] = 0.;
-            _pose.vecAcceleration[2] = 0.;
+            pose.vecAcceleration[0] = 0.;
+            pose.vecAcceleration[1] = 0.;
+            pose.vecAcceleration[2] = 0.;
         }
 
         // If the sender defines its own ang velocity
         if (tracker.AngularVelocity.HasValue)
         {
             // Angular Velocity
-            _pose.vecAngularVelocity[0] = tracker.AngularVelocity.Value.X;
-            _pose.vecAngularVelocity[1] = tracker.AngularVelocity.Value.Y;
-            _pose.vecAngularVelocity[2] = tracker.AngularVelocity.Value.Z;
+            pose.vecAngularVelocity[0] = tracker.AngularVelocity.Value.X;
+            pose.vecAngularVelocity[1] = tracker.AngularVelocity.Value.Y;
+            pose.vecAngularVelocity[2] = tracker.AngularVelocity.Value.Z;
         }
         else
         {
             // Angular Velocity
-            _pose.vecAngularVelocity[0] = 0.;
-            _pose.vecAngularVelocity[1] = 0.;
-            _pose.vecAngularVelocity[2] = 0.;
+            pose.vecAngularVelocity[0] = 0.;
+            pose.vecAngularVelocity[1] = 0.;
+            pose.vecAngularVelocity[2] = 0.;
         }
 
         // If the sender defines its own ang acceleration
         if (tracker.AngularAcceleration.HasValue)
         {
             // Angular Acceleration
-            _pose.vecAngularAcceleration[0] = tracker.AngularAcceleration.Value.X;
-            _pose.vecAngularAcceleration[1] = tracker.AngularAcceleration.Value.Y;
-            _pose.vecAngularAcceleration[2] = tracker.AngularAcceleration.Value.Z;
+            pose.vecAngularAcceleration[0] = tracker.AngularAcceleration.Value.X;
+            pose.vecAngularAcceleration[1] = tracker.AngularAcceleration.Value.Y;
+            pose.vecAngularAcceleration[2] = tracker.AngularAcceleration.Value.Z;
         }
         else
         {
             // Angular Acceleration
-            _pose.vecAngularAcceleration[0] = 0.;
-            _pose.vecAngularAcceleration[1] = 0.;
-            _pose.vecAngularAcceleration[2] = 0.;
+            pose.vecAngularAcceleration[0] = 0.;
+            pose.vecAngularAcceleration[1] = 0.;
+            pose.vecAngularAcceleration[2] = 0.;
         }
+
+        _pose.store(pose);
     }
     catch (...)
     {
@@ -310,5 +320,7 @@ vr::EVRInitError BodyTracker::Activate(vr::TrackedDeviceIndex_t index)
 
 vr::DriverPose_t BodyTracker::GetPose()
 {
-    return _pose;
+    auto pose = _pose.load();
+    pose.deviceIsConnected = _active;
+    return pose;
 }
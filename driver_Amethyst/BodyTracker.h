@@ -4,6 +4,7 @@
 #include <openvr_driver.h>
 
 #include "DataContract.h"
+#include "util/seqlock.hpp"
 
 #define AME_API_GET_TIMESTAMP_NOW \
 	std::chrono::time_point_cast<std::chrono::microseconds>	\
@@ -172,14 +173,14 @@ public:
 
 private:
     // Is tracker added/active
-    bool _added = false, _active = false, _valid = false;
+    bool _added = false, _active = false;
     bool _activated = false;
 
     // Stores the openvr supplied device index.
     vr::TrackedDeviceIndex_t _index;
 
-    // Stores the devices current pose.
-    vr::DriverPose_t _pose;
+    // Stores the devices current pose (written by set_pose, read by update/GetPose)
+    Util::seqlock<vr::DriverPose_t> _pose;
 
     // An identifier for OpenVR for when we want to make property changes to this device.
     vr::PropertyContainerHandle_t _props;
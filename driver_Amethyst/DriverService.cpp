@@ -31,23 +31,23 @@ HRESULT DriverService::SetTrackerState(dTrackerBase tracker)
         // Check the state and attempts spawning the tracker
         if (!p_tracker->is_added() && !p_tracker->spawn())
         {
-            logMessage(std::format("Couldn't spawn tracker ID {} due to an unknown native exception.",
-                                   static_cast<int>(tracker.Role)));
+            logFormat("Couldn't spawn tracker ID {} due to an unknown native exception.",
+                      static_cast<int>(tracker.Role));
             return E_FAIL; // Failure
         }
 
         // Set the state of the native tracker
         p_tracker->set_state(tracker.ConnectionState);
-        logMessage(std::format("Tracker ID {} state set to {}.",
-                               static_cast<int>(tracker.Role), tracker.ConnectionState == 1));
+        logFormat("Tracker ID {} state set to {}.",
+                  static_cast<int>(tracker.Role), tracker.ConnectionState == 1);
 
         // Call the VR update handler and compose the result
         tracker_vector_->at(tracker.Role).update();
         return S_OK;
     }
 
-    logMessage(std::format("Couldn't spawn tracker ID {}. The tracker index was out of bounds.",
-                           static_cast<int>(tracker.Role)));
+    logFormat("Couldn't spawn tracker ID {}. The tracker index was out of bounds.",
+              static_cast<int>(tracker.Role));
 
     return ERROR_INVALID_INDEX; // Failure
 }
@@ -60,8 +60,8 @@ HRESULT DriverService::UpdateTracker(dTrackerBase tracker)
         // Update the pose of the passed tracker
         if (!tracker_vector_->at(tracker.Role).set_pose(tracker))
         {
-            logMessage(std::format("Couldn't spawn tracker ID {} due to an unknown native exception.",
-                                   static_cast<int>(tracker.Role)));
+            logFormat("Couldn't spawn tracker ID {} due to an unknown native exception.",
+                      static_cast<int>(tracker.Role));
             return E_FAIL; // Failure
         }
 
@@ -69,12 +69,38 @@ HRESULT DriverService::UpdateTracker(dTrackerBase tracker)
         return S_OK;
     }
 
-    logMessage(std::format("Couldn't spawn tracker ID {}. The tracker index was out of bounds.",
-                           static_cast<int>(tracker.Role)));
+    logFormat("Couldn't spawn tracker ID {}. The tracker index was out of bounds.",
+              static_cast<int>(tracker.Role));
 
     return ERROR_INVALID_INDEX; // Failure
 }
 
+HRESULT DriverService::SetTrackerStateVector(const unsigned int count, dTrackerBase* trackers, HRESULT* results)
+{
+    if (tracker_vector_ == nullptr) return E_FAIL;
+    if (count > 0 && (trackers == nullptr || results == nullptr)) return E_POINTER;
+
+    // Apply all states, S_FALSE if any of them didn't succeed
+    auto result = S_OK;
+    for (unsigned int i = 0; i < count; i++)
+        if ((results[i] = SetTrackerState(trackers[i])) != S_OK) result = S_FALSE;
+
+    return result;
+}
+
+HRESULT DriverService::UpdateTrackerVector(const unsigned int count, dTrackerBase* trackers, HRESULT* results)
+{
+    if (tracker_vector_ == nullptr) return E_FAIL;
+    if (count > 0 && (trackers == nullptr || results == nullptr)) return E_POINTER;
+
+    // Apply all poses, S_FALSE if any of them didn't succeed
+    auto result = S_OK;
+    for (unsigned int i = 0; i < count; i++)
+        if ((results[i] = UpdateTracker(trackers[i])) != S_OK) result = S_FALSE;
+
+    return result;
+}
+
 HRESULT DriverService::RequestVrRestart(wchar_t* message)
 {
     // Sanity check
@@ -102,8 +128,9 @@ HRESULT DriverService::PingDriverService(long long* ms)
         return ERROR_EMPTY; // Compose the reply
     }
 
-    // Perform the request
-    *ms = std::chrono::system_clock::now().time_since_epoch().count();
+    // Perform the request (Unix time)
+    *ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
 
     return S_OK; // Compose the reply
 }
@@ -46,6 +46,10 @@ public:
     HRESULT STDMETHODCALLTYPE RequestVrRestart(wchar_t* message) override;
     HRESULT STDMETHODCALLTYPE PingDriverService(__int64* ms) override;
 
+    // Batched variants: one call for all trackers, per-tracker results in 'results'
+    HRESULT STDMETHODCALLTYPE SetTrackerStateVector(unsigned int count, dTrackerBase* trackers, HRESULT* results) override;
+    HRESULT STDMETHODCALLTYPE UpdateTrackerVector(unsigned int count, dTrackerBase* trackers, HRESULT* results) override;
+
     ~DriverService() override;
 
     static void InstallProxyStub();
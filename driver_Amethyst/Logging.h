@@ -6,21 +6,43 @@
 //
 
 #pragma once
+#include <format>
 #include <openvr_driver.h>
 #include <string>
 
-inline void logMessage(const std::string& message)
+#include "util/async_logger.hpp"
+
+// Final sink, called from the logger thread (or directly when it's not running)
+inline void logToDriver(const char* message)
 {
     if (vr::VRDriverContext() && vr::VRDriverLog())
     {
-        vr::VRDriverLog()->Log(message.c_str());
+        vr::VRDriverLog()->Log(message);
     }
     else
     {
-        OutputDebugStringA(message.c_str());
+        OutputDebugStringA(message);
     }
 }
 
+// Messages are queued and written out by a background thread,
+// so logging never blocks the COM or SteamVR threads.
+// Started once Init succeeds and stopped in Cleanup; never destroyed,
+// so nothing joins the writer thread while the driver is unloading.
+inline Util::async_logger<>& g_driver_log = *new Util::async_logger<>{&logToDriver};
+
+inline void logMessage(const std::string& message)
+{
+    g_driver_log.post(message);
+}
+
+// Deferred formatting: arithmetic arguments are formatted on the logger thread
+template <typename... Args>
+void logFormat(std::format_string<Args...> fmt, Args&&... args)
+{
+    g_driver_log.post(fmt, std::forward<Args>(args)...);
+}
+
 // Wide String to UTF8 String
 inline std::string WStringToString(const std::wstring& w_str)
 {
@@ -50,6 +50,9 @@ public:
         for (auto& tracker : tracker_vector_)
             logMessage(std::format("Registered a tracker: ({})", tracker.get_serial()));
 
+        // Start the background log writer (Init can't fail past this point)
+        g_driver_log.start();
+
         // That's all, mark as okay
         return vr::VRInitError_None;
     }
@@ -153,6 +156,8 @@ public:
 
     void Cleanup() override
     {
+        // Flush the log queue, anything logged later is written directly
+        g_driver_log.stop();
     }
 
     const char* const* GetInterfaceVersions() override
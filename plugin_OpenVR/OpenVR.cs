@@ -1,4 +1,5 @@
 using System;
+using System.Collections.Concurrent;
 using System.Collections.Generic;
 using System.ComponentModel;
 using System.ComponentModel.Composition;
@@ -37,6 +38,17 @@ public class SteamVR : IServiceEndpoint
 {
     private driver_00Amethyst.IDriverService _00driverService;
     private driver_Amethyst.IDriverService _driverService;
+    private IDriverServiceBatch00 _00driverBatch; // Same object, array methods
+    private IDriverServiceBatch _driverBatch;
+    private PoseChannel _poseChannel;
+    private readonly Dictionary<(TrackerType Tracker, string Guid), uint> _inputTokens = new();
+
+    // Latest pose per role waiting for the background COM submitter (wantReply: false)
+    private readonly ConcurrentDictionary<TrackerType, driver_00Amethyst.dPoseSample> _pendingPoses = new();
+    private int _poseSubmitterRunning;
+    private int _poseSubmitFailures;
+    private volatile Task _poseSubmitter = Task.CompletedTask;
+    private CancellationTokenSource _poseSubmitterCancel = new();
 
     private InputActions _controllerInputActions = new()
     {
@@ -89,6 +101,12 @@ public class SteamVR : IServiceEndpoint
 
     private dynamic DriverService => IsEmulationEnabled ? _00driverService : _driverService;
 
+    // Space of the poses read from and sent to SteamVR. The emulation driver maps standing poses back
+    // to raw itself (SetWorldFromDriverTransform), the other one takes raw poses
+    private ETrackingUniverseOrigin PoseUniverse => IsEmulationEnabled
+        ? ETrackingUniverseOrigin.TrackingUniverseStanding
+        : ETrackingUniverseOrigin.TrackingUniverseRawAndUncalibrated;
+
     private Exception ServerDriverException { get; set; }
     private bool ServerDriverPresent => ServiceStatus == 0;
 
@@ -497,6 +515,7 @@ public class SteamVR : IServiceEndpoint
         lock (Host.UpdateThreadLock)
         {
             Initialized = false; // vrClient dll unloaded
+            StopPoseSubmitterAsync().Wait();
             OpenVR.Shutdown(); // Shutdown OpenVR
 
             ServiceStatus = 1; // Update VR status
@@ -552,10 +571,9 @@ public class SteamVR : IServiceEndpoint
             if (!Initialized || OpenVR.System is null) return (Vector3.Zero, Quaternion.Identity); // Sanity check
             // if (IsHeadsetEmulationEnabled) return null; // Sanity check don't inbreed calibration poses
 
-            // Capture RAW HMD pose
+            // Capture the HMD pose, in the same space as the tracker poses
             var devicePose = new TrackedDevicePose_t[1]; // HMD only
-            OpenVR.System.GetDeviceToAbsoluteTrackingPose(
-                ETrackingUniverseOrigin.TrackingUniverseStanding, 0, devicePose);
+            OpenVR.System.GetDeviceToAbsoluteTrackingPose(PoseUniverse, 0, devicePose);
 
             // Assert that HMD is at index 0
             if (OpenVR.System.GetTrackedDeviceClass(0) != ETrackedDeviceClass.HMD)
@@ -566,10 +584,8 @@ public class SteamVR : IServiceEndpoint
                     devicePose[0].mDeviceToAbsoluteTracking.GetOrientation());
 
             return (IsHeadsetEmulationEnabled
-                    ? Vector3.Zero // Return 0,0,0 if emulating a tracked headset
-                    : Vector3.Transform(raw.Position - VrPlayspaceTranslation,
-                        Quaternion.Inverse(VrPlayspaceOrientationQuaternion)),
-                Quaternion.Inverse(VrPlayspaceOrientationQuaternion) * raw.Orientation);
+                ? Vector3.Zero // Return 0,0,0 if emulating a tracked headset
+                : raw.Position, raw.Orientation);
         }
     }
 
@@ -587,20 +603,16 @@ public class SteamVR : IServiceEndpoint
             return serialStringBuilder.ToString();
         }
 
+        // Already in PoseUniverse, no per-device playspace math needed
         var devicePose = new TrackedDevicePose_t[OpenVR.k_unMaxTrackedDeviceCount];
-        OpenVR.System.GetDeviceToAbsoluteTrackingPose(
-            ETrackingUniverseOrigin.TrackingUniverseStanding, 0, devicePose);
+        OpenVR.System.GetDeviceToAbsoluteTrackingPose(PoseUniverse, 0, devicePose);
 
         // Get pos & rot
         return devicePose.Select((x, i) => new TrackerBase
         {
             Serial = GetDeviceName((uint)i),
-            Position = Vector3.Transform(x
-                    .mDeviceToAbsoluteTracking.GetPosition() - VrPlayspaceTranslation,
-                Quaternion.Inverse(VrPlayspaceOrientationQuaternion)),
-
-            Orientation = Quaternion.Inverse(VrPlayspaceOrientationQuaternion) *
-                          x.mDeviceToAbsoluteTracking.GetOrientation()
+            Position = x.mDeviceToAbsoluteTracking.GetPosition(),
+            Orientation = x.mDeviceToAbsoluteTracking.GetOrientation()
         }).ToList();
     }
 
@@ -644,8 +656,7 @@ public class SteamVR : IServiceEndpoint
         }
 
         var devicePose = new TrackedDevicePose_t[OpenVR.k_unMaxTrackedDeviceCount];
-        OpenVR.System.GetDeviceToAbsoluteTrackingPose(
-            ETrackingUniverseOrigin.TrackingUniverseStanding, 0, devicePose);
+        OpenVR.System.GetDeviceToAbsoluteTrackingPose(PoseUniverse, 0, devicePose);
 
         var trackerPair = FindVrTracker(contains, false);
         if (!trackerPair.Found) return null;
@@ -657,12 +668,8 @@ public class SteamVR : IServiceEndpoint
         // Get pos & rot
         return new TrackerBase
         {
-            Position = Vector3.Transform(waistPose
-                    .mDeviceToAbsoluteTracking.GetPosition() - VrPlayspaceTranslation,
-                Quaternion.Inverse(VrPlayspaceOrientationQuaternion)),
-
-            Orientation = Quaternion.Inverse(VrPlayspaceOrientationQuaternion) *
-                          waistPose.mDeviceToAbsoluteTracking.GetOrientation()
+            Position = waistPose.mDeviceToAbsoluteTracking.GetPosition(),
+            Orientation = waistPose.mDeviceToAbsoluteTracking.GetOrientation()
         };
     }
 
@@ -676,14 +683,17 @@ public class SteamVR : IServiceEndpoint
                 return Task.FromResult<IEnumerable<(TrackerBase Tracker, bool Success)>>(
                     wantReply ? new List<(TrackerBase Tracker, bool Success)>() : null);
 
+            // All trackers in one call, with a result for each (S_OK, or a failure/Win32 code)
             var enumTrackerBases = trackerBases.ToList();
-            foreach (var trackerBase in enumTrackerBases.ToList())
-                if (IsEmulationEnabled)
-                    _00driverService?.SetTrackerState(trackerBase.ComTracker00(IsStandableSupportEnabled));
-                else
-                    _driverService?.SetTrackerState(trackerBase.ComTracker(IsStandableSupportEnabled));
+            var results = new int[enumTrackerBases.Count];
+            if (IsEmulationEnabled)
+                _00driverBatch?.SetTrackerStateVector((uint)results.Length, enumTrackerBases
+                    .Select(x => x.ComTracker00(IsStandableSupportEnabled)).ToArray(), results);
+            else
+                _driverBatch?.SetTrackerStateVector((uint)results.Length, enumTrackerBases
+                    .Select(x => x.ComTracker(IsStandableSupportEnabled)).ToArray(), results);
 
-            return Task.FromResult(wantReply ? enumTrackerBases.Select(x => (x, true)) : null);
+            return Task.FromResult(wantReply ? enumTrackerBases.Select((x, i) => (x, results[i] == 0)) : null);
         }
         catch (Exception e)
         {
@@ -704,13 +714,40 @@ public class SteamVR : IServiceEndpoint
                     wantReply ? new List<(TrackerBase Tracker, bool Success)>() : null);
 
             var enumTrackerBases = trackerBases.ToList();
-            foreach (var trackerBase in enumTrackerBases.ToList())
+            var results = new int[enumTrackerBases.Count];
+            var viaCom = new List<int>(enumTrackerBases.Count); // Indices left for COM
+
+            for (var i = 0; i < enumTrackerBases.Count; i++)
+            {
+                // Prefer the shared memory channel, fall back to COM
+                if (IsEmulationEnabled && _poseChannel?.TryWrite(enumTrackerBases[i], IsStandableSupportEnabled) is true) continue;
+                if (IsEmulationEnabled && !wantReply)
+                    _pendingPoses[enumTrackerBases[i].Role] = enumTrackerBases[i].ComPose00(IsStandableSupportEnabled);
+                else viaCom.Add(i);
+            }
+
+            // The rest in one call, with a result for each
+            if (viaCom.Count > 0)
+            {
+                var comResults = new int[viaCom.Count];
                 if (IsEmulationEnabled)
-                    _00driverService?.UpdateTracker(trackerBase.ComTracker00(IsStandableSupportEnabled));
+                    _00driverBatch?.UpdateTrackerVector((uint)viaCom.Count, viaCom
+                        .Select(i => enumTrackerBases[i].ComTracker00(IsStandableSupportEnabled)).ToArray(), comResults);
                 else
-                    _driverService?.UpdateTracker(trackerBase.ComTracker(IsStandableSupportEnabled));
+                    _driverBatch?.UpdateTrackerVector((uint)viaCom.Count, viaCom
+                        .Select(i => enumTrackerBases[i].ComTracker(IsStandableSupportEnabled)).ToArray(), comResults);
 
-            return Task.FromResult(wantReply ? enumTrackerBases.Select(x => (x, true)) : null);
+                for (var j = 0; j < viaCom.Count; j++) results[viaCom[j]] = comResults[j];
+            }
+
+            // Hand the queued poses over without waiting for the driver
+            if (!_pendingPoses.IsEmpty && Interlocked.Exchange(ref _poseSubmitterRunning, 1) == 0)
+            {
+                var cancel = _poseSubmitterCancel.Token;
+                _poseSubmitter = Task.Run(() => SubmitPendingPoses(cancel));
+            }
+
+            return Task.FromResult(wantReply ? enumTrackerBases.Select((x, i) => (x, results[i] == 0)) : null);
         }
         catch (Exception e)
         {
@@ -720,6 +757,49 @@ public class SteamVR : IServiceEndpoint
         }
     }
 
+    // Fire-and-forget COM submission: the tracking thread never waits for the driver.
+    // Rejected poses are counted driver-side (GetSubmissionStats), failed calls in _poseSubmitFailures
+    private void SubmitPendingPoses(CancellationToken cancel)
+    {
+        var batch = new List<driver_00Amethyst.dPoseSample>();
+        do
+        {
+            // Everything queued so far goes in one call
+            batch.Clear();
+            foreach (var role in _pendingPoses.Keys)
+                if (_pendingPoses.TryRemove(role, out var pose))
+                    batch.Add(pose);
+
+            if (batch.Count > 0 && !cancel.IsCancellationRequested)
+                try
+                {
+                    _00driverBatch?.SubmitTrackerPoses((uint)batch.Count, batch.ToArray());
+                }
+                catch (Exception e)
+                {
+                    // Log the 1st, 2nd, 4th, 8th... failure: a dead service fails every frame
+                    var failures = Interlocked.Increment(ref _poseSubmitFailures);
+                    if (BitOperations.IsPow2(failures))
+                        Host?.Log($"Failed to submit queued poses ({failures} failures so far): {e.Message}",
+                            LogSeverity.Warning);
+                }
+
+            Volatile.Write(ref _poseSubmitterRunning, 0);
+        } while (!cancel.IsCancellationRequested && !_pendingPoses.IsEmpty &&
+                 Interlocked.Exchange(ref _poseSubmitterRunning, 1) == 0);
+    }
+
+    // Stop the submitter and drop what's queued, before switching services or shutting down.
+    // Bounded, since a call into a hung driver can't be cancelled, and context-free for Shutdown's sync wait
+    private async Task StopPoseSubmitterAsync()
+    {
+        _poseSubmitterCancel.Cancel();
+        await Task.WhenAny(_poseSubmitter, Task.Delay(TimeSpan.FromSeconds(1))).ConfigureAwait(false);
+
+        _poseSubmitterCancel = new CancellationTokenSource();
+        _pendingPoses.Clear();
+    }
+
     public Task ProcessKeyInput(IKeyInputAction action, object data, TrackerType? receiver, CancellationToken? token = null)
     {
         if (!IsEmulationEnabled)
@@ -729,6 +809,8 @@ public class SteamVR : IServiceEndpoint
         }
 
         if (!Initialized || OpenVR.System is null || DriverService is null || ServiceStatus != 0) return Task.CompletedTask;
+        var timestamp = OvrExtensions.SteadyTimestamp();
+
         if (data is null || action.DataType != data.GetType())
         {
             Host?.Log($"Received invalid data {data} with type {data?.GetType()} incompatible " +
@@ -740,28 +822,54 @@ public class SteamVR : IServiceEndpoint
         if (data is not false && data is not 0.0f && data is not 0.0) // Log only for actual data input and not defaults
             Host?.Log($"Processed key input \"{action.Name}\" of type {action.DataType} with data {data} for {trackerType}.");
 
-        switch (data)
+        // Resolve the action once, then update it by its token
+        if (!TryGetInputToken(trackerType, action.Guid, out var inputToken)) return Task.CompletedTask;
+
+        var update = data switch
         {
-            case bool boolData:
-                if (IsEmulationEnabled)
-                    _00driverService?.UpdateInputBoolean((driver_00Amethyst.dTrackerType)trackerType, action.Guid, Convert.ToSByte(boolData));
-                break;
-            case float scalarData:
-                if (IsEmulationEnabled)
-                    _00driverService?.UpdateInputScalar((driver_00Amethyst.dTrackerType)trackerType, action.Guid, scalarData);
-                break;
-            case double scalarData:
-                if (IsEmulationEnabled)
-                    _00driverService?.UpdateInputScalar((driver_00Amethyst.dTrackerType)trackerType, action.Guid, (float)scalarData);
-                break;
-            default:
-                Host?.Log($"Data {data} with type {data.GetType()} was not processed because its type is not supported.");
-                break;
+            bool boolData => new driver_00Amethyst.dInputUpdate { Token = inputToken, Value = boolData ? 1.0f : 0.0f },
+            float scalarData => new driver_00Amethyst.dInputUpdate { Token = inputToken, IsScalar = 1, Value = scalarData },
+            double scalarData => new driver_00Amethyst.dInputUpdate { Token = inputToken, IsScalar = 1, Value = (float)scalarData },
+            _ => (driver_00Amethyst.dInputUpdate?)null
+        };
+
+        if (update is null)
+        {
+            Host?.Log($"Data {data} with type {data.GetType()} was not processed because its type is not supported.");
+            return Task.CompletedTask;
         }
 
+        // Sent with its capture time, so the driver can back-date the input event
+        var results = new int[1];
+        var result = _00driverBatch?.UpdateInputVector(
+            (driver_00Amethyst.dTrackerType)trackerType, timestamp, 1, [update.Value], results);
+
+        if (result is not (null or 0)) // S_FALSE: the update itself failed, see its result
+            Host?.Log($"Key input \"{action.Name}\" was rejected by the driver " +
+                      $"(0x{(result is 1 ? results[0] : result):X8}).");
+
         return Task.CompletedTask;
     }
 
+    private bool TryGetInputToken(TrackerType trackerType, string guid, out uint token)
+    {
+        lock (_inputTokens)
+        {
+            if (_inputTokens.TryGetValue((trackerType, guid), out token)) return true;
+            if (_00driverService is null) return false;
+
+            _00driverService.RegisterInputAction((driver_00Amethyst.dTrackerType)trackerType, guid, out token);
+            if (token == uint.MaxValue)
+            {
+                Host?.Log($"Input action {guid} is not known to the driver for {trackerType}.");
+                return false;
+            }
+
+            _inputTokens[(trackerType, guid)] = token;
+            return true;
+        }
+    }
+
     public Task<(int Status, string StatusMessage, long PingTime)> TestConnection()
     {
         try
@@ -778,21 +886,31 @@ public class SteamVR : IServiceEndpoint
                 return Task.FromResult<(int Status, string StatusMessage, long PingTime)>(
                     (-1, "SERVICE_INVALID", 0));
 
+            if (IsEmulationEnabled)
+            {
+                var probe = ProbeDriverLatency();
+                Host.Log($"Driver round trip: min {probe.Min}us, median {probe.Median}us, p99 {probe.P99}us " +
+                         $"(one-way {probe.Forward}us there, {probe.Backward}us back, clock skew {probe.Skew}us)");
+
+                LogPoseLatency();
+
+                _00driverService.GetSubmissionStats(out var stats);
+                Host.Log($"Pose submissions: {stats.Received} received, {stats.Rejected} rejected, " +
+                         $"{stats.Coalesced} coalesced, {Volatile.Read(ref _poseSubmitFailures)} failed to send");
+
+                // Return tuple with response and the median round trip
+                return Task.FromResult((0, "OK", probe.Median * Stopwatch.Frequency / 1_000_000));
+            }
+
             // Grab the current time and send the message
             var messageSendTimeStopwatch = new Stopwatch();
 
             messageSendTimeStopwatch.Start();
-
-            long ms = 0;
-            if (IsEmulationEnabled)
-                _00driverService.PingDriverService(out ms);
-            else
-                _driverService.PingDriverService(out ms);
-
+            _driverService.PingDriverService(out _);
             messageSendTimeStopwatch.Stop();
 
             // Return tuple with response and elapsed time
-            Host.Log($"Ping: {ms - DateTimeOffset.Now.ToUnixTimeMilliseconds()}ms");
+            Host.Log($"Ping: {messageSendTimeStopwatch.Elapsed.TotalMilliseconds:F3}ms");
             return Task.FromResult((0, "OK", messageSendTimeStopwatch.ElapsedTicks));
         }
         catch (Exception e)
@@ -803,6 +921,65 @@ public class SteamVR : IServiceEndpoint
         }
     }
 
+    // Round trips on the steady clock shared with the driver, all values in microseconds
+    private (long Min, long Median, long P99, long Forward, long Backward, long Skew)
+        ProbeDriverLatency(int samples = 32)
+    {
+        var roundTrips = new long[samples];
+        var forward = new long[samples];
+        var backward = new long[samples];
+        var skew = new long[samples];
+
+        for (var i = 0; i < samples; i++)
+        {
+            var sent = OvrExtensions.SteadyTimestamp();
+            _00driverService.ProbeLatency(out var received, out var replied);
+            var returned = OvrExtensions.SteadyTimestamp();
+
+            // Time spent inside the driver isn't part of the round trip
+            roundTrips[i] = returned - sent - (replied - received);
+            forward[i] = received - sent;
+            backward[i] = returned - replied;
+            skew[i] = (forward[i] - backward[i]) / 2; // NTP-style clock offset estimate
+        }
+
+        Array.Sort(roundTrips);
+        Array.Sort(forward);
+        Array.Sort(backward);
+        Array.Sort(skew);
+
+        // One-way times corrected by the (median) estimated offset
+        var median = samples / 2;
+        var p99 = Math.Clamp((int)Math.Ceiling(samples * 0.99) - 1, 0, samples - 1);
+        return (roundTrips[0], roundTrips[median], roundTrips[p99],
+            forward[median] - skew[median], backward[median] + skew[median], skew[median]);
+    }
+
+    // Sample-to-driver latency per transport and sample-to-frame latency of the actual pose path, per tracker
+    private void LogPoseLatency()
+    {
+        foreach (var role in Enum.GetValues<TrackerType>())
+        {
+            if (role is TrackerType.TrackerHead) continue; // Not a tracker
+            var consumption = new driver_00Amethyst.dLatencyStats();
+
+            foreach (var transport in Enum.GetValues<driver_00Amethyst.dPoseTransport>())
+            {
+                _00driverService.GetPoseLatency((driver_00Amethyst.dTrackerType)role, transport,
+                    out var arrival, out consumption);
+
+                if (arrival.Count <= 0) continue; // Nothing timestamped came this way
+                Host.Log($"{role} pose latency via " +
+                         $"{(transport is driver_00Amethyst.dPoseTransport.PoseTransport_Channel ? "shared memory" : "COM")}: " +
+                         $"arrival p50 <= {arrival.Median}us, p99 <= {arrival.P99}us over {arrival.Count} samples");
+            }
+
+            if (consumption.Count <= 0) continue; // Nothing applied yet
+            Host.Log($"{role} pose latency until applied: p50 <= {consumption.Median}us, " +
+                     $"p99 <= {consumption.P99}us over {consumption.Count} samples");
+        }
+    }
+
     #region Amethyst VRDriver Methods
 
     private async Task<int> InitAmethystServerAsync(string target)
@@ -818,9 +995,28 @@ public class SteamVR : IServiceEndpoint
 
             DriverHelper.GetActiveObject(ref guid, IntPtr.Zero, out var service);
 
+            // Methods and structs are positional: a driver from another version would misread every call
+            var apiVersion = DriverHelper.GetDriverApiVersion(service, IsEmulationEnabled);
+            Host?.Log($"Driver API version: {apiVersion} (expected {DriverHelper.DriverApiVersion})");
+            if (apiVersion != DriverHelper.DriverApiVersion)
+                throw new InvalidOperationException(
+                    $"The running SteamVR driver uses API version {apiVersion}, " +
+                    $"this plugin needs version {DriverHelper.DriverApiVersion}. Reinstall the driver and restart SteamVR.");
+
+            await StopPoseSubmitterAsync(); // Its poses were meant for the previous instance
+
             Host?.Log($"Trying to cast the service into {typeof(driver_Amethyst.IDriverService)}...");
             _driverService = IsEmulationEnabled ? null : (driver_Amethyst.IDriverService)service;
             _00driverService = IsEmulationEnabled ? (driver_00Amethyst.IDriverService)service : null;
+            _driverBatch = IsEmulationEnabled ? null : (IDriverServiceBatch)service;
+            _00driverBatch = IsEmulationEnabled ? (IDriverServiceBatch00)service : null;
+            lock (_inputTokens) _inputTokens.Clear(); // Tokens are per driver instance
+
+            _poseChannel?.Dispose();
+            _poseChannel = IsEmulationEnabled ? PoseChannel.TryOpen() : null;
+            Host?.Log($"Shared pose channel is {(_poseChannel is null ? "unavailable" : "available")}.");
+
+            PublishPlayspaceTransform(); // Also replaces one left by a previous session
 
             Host?.Log($"{nameof(service)} is {DriverService?.GetType()}!");
         }
@@ -888,14 +1084,18 @@ public class SteamVR : IServiceEndpoint
                 if (DriverService is null)
                     return -2;
 
-                // Grab the current time and send the message
-                long ms;
+                // Check that the service responds
                 if (IsEmulationEnabled)
-                    _00driverService.PingDriverService(out ms);
+                {
+                    var probe = ProbeDriverLatency(8);
+                    Host.Log($"Driver round trip: min {probe.Min}us, median {probe.Median}us, p99 {probe.P99}us");
+                }
                 else
-                    _driverService.PingDriverService(out ms);
-
-                Host.Log($"Ping: {ms - DateTimeOffset.Now.ToUnixTimeMilliseconds()}ms");
+                {
+                    var stopwatch = Stopwatch.StartNew();
+                    _driverService.PingDriverService(out _);
+                    Host.Log($"Ping: {stopwatch.Elapsed.TotalMilliseconds:F3}ms");
+                }
 
                 return 0; // Everything should be fine
             }
@@ -1081,19 +1281,65 @@ public class SteamVR : IServiceEndpoint
 
     private void ParseVrEvents()
     {
-        // Poll and parse all needed VR (overlay) events
+        // Poll and parse all needed VR (system and overlay) events. The plugin has no other consumer of
+        // either queue, so everything is dispatched from here (HandleVrEvent) instead of being dropped
         if (!Initialized || OpenVR.System is null || OpenVR.Overlay is null) return;
 
         var vrEvent = new VREvent_t();
-        while (OpenVR.Overlay.PollNextOverlayEvent(_vrOverlayHandle,
+        var playspaceChanged = false;
+
+        while (Initialized && OpenVR.System.PollNextEvent(ref vrEvent, (uint)Marshal.SizeOf<VREvent_t>()))
+            playspaceChanged |= HandleVrEvent(vrEvent);
+
+        while (Initialized && OpenVR.Overlay.PollNextOverlayEvent(_vrOverlayHandle,
                    ref vrEvent, (uint)Marshal.SizeOf<VREvent_t>()))
+            playspaceChanged |= HandleVrEvent(vrEvent);
+
+        // Once per batch of events, the driver applies it to all trackers on its next frame
+        if (playspaceChanged && Initialized) PublishPlayspaceTransform();
+    }
+
+    // Returns whether the playspace transform has to be published again
+    private bool HandleVrEvent(in VREvent_t vrEvent)
+    {
+        switch ((EVREventType)vrEvent.eventType)
+        {
+            case EVREventType.VREvent_ChaperoneUniverseHasChanged:
+            case EVREventType.VREvent_ChaperoneDataHasChanged:
+            case EVREventType.VREvent_ChaperoneTempDataHasChanged:
+            case EVREventType.VREvent_StandingZeroPoseReset:
+                return true;
+
+            case EVREventType.VREvent_Quit:
+                Host.Log("VREvent_Quit has been called, requesting more time for handling the exit...");
+
+                Initialized = false; // Mark as not initialized to block all actions with requirements of such
+                _ = Task.Run(() => Host.RequestExit("OpenVR shutting down!")); // 1s before shutdown
+                OpenVR.System.AcknowledgeQuit_Exiting(); // We have 1s to call this, amethyst shuts down next
+                return false;
+
+            default:
+                return false;
+        }
+    }
+
+    // Tracker poses are sent in standing space (PoseUniverse), SteamVR composes them into raw space
+    // with the driver-stamped inverse of the raw-to-standing transform
+    private void PublishPlayspaceTransform()
+    {
+        if (!IsEmulationEnabled || _00driverService is null || OpenVR.System is null) return;
+
+        try
         {
-            if (vrEvent.eventType != (uint)EVREventType.VREvent_Quit) continue;
-            Host.Log("VREvent_Quit has been called, requesting more time for handling the exit...");
+            var standingFromRaw = OpenVR.System.GetRawZeroPoseToStandingAbsoluteTrackingPose();
+            var rotation = Quaternion.Inverse(standingFromRaw.GetOrientation());
+            var translation = Vector3.Transform(-standingFromRaw.GetPosition(), rotation);
 
-            Initialized = false; // Mark as not initialized to block all actions with requirements of such
-            _ = Task.Run(() => Host.RequestExit("OpenVR shutting down!")); // 1s before shutdown
-            OpenVR.System.AcknowledgeQuit_Exiting(); // We have 1s to call this, amethyst shuts down next
+            _00driverService.SetWorldFromDriverTransform(translation.ComVector00(), rotation.ComQuaternion00());
+        }
+        catch (Exception e)
+        {
+            Host?.Log($"Failed to update the driver's playspace transform: {e.Message}", LogSeverity.Warning);
         }
     }
 
@@ -1280,10 +1526,48 @@ public static class OvrExtensions
             Velocity = tracker.Velocity.ComVector00(),
             Acceleration = tracker.Acceleration.ComVector00(),
             AngularVelocity = tracker.AngularVelocity.ComVector00(),
-            AngularAcceleration = tracker.AngularAcceleration.ComVector00()
+            AngularAcceleration = tracker.AngularAcceleration.ComVector00(),
+            Timestamp = SteadyTimestamp()
         };
     }
 
+    // Fixed-layout pose packet for UpdateTrackerCompact (no serial string to marshal)
+    public static driver_00Amethyst.dPoseSample ComPose00(this TrackerBase tracker, bool allowInferred)
+    {
+        var tracked = allowInferred
+            ? tracker.TrackingState is not TrackedJointState.StateNotTracked
+            : tracker.TrackingState is TrackedJointState.StateTracked;
+
+        var flags = (tracked ? driver_00Amethyst.dPoseSampleFlags.PoseSample_Tracked : 0) |
+                    (tracker.Velocity.HasValue ? driver_00Amethyst.dPoseSampleFlags.PoseSample_HasVelocity : 0) |
+                    (tracker.Acceleration.HasValue ? driver_00Amethyst.dPoseSampleFlags.PoseSample_HasAcceleration : 0) |
+                    (tracker.AngularVelocity.HasValue
+                        ? driver_00Amethyst.dPoseSampleFlags.PoseSample_HasAngularVelocity
+                        : 0) |
+                    (tracker.AngularAcceleration.HasValue
+                        ? driver_00Amethyst.dPoseSampleFlags.PoseSample_HasAngularAcceleration
+                        : 0);
+
+        return new driver_00Amethyst.dPoseSample
+        {
+            Role = (byte)tracker.Role,
+            Flags = (byte)flags,
+            Position = tracker.Position.ComVector00(),
+            Orientation = tracker.Orientation.ComQuaternion00(),
+            Velocity = tracker.Velocity.GetValueOrDefault().ComVector00(),
+            Acceleration = tracker.Acceleration.GetValueOrDefault().ComVector00(),
+            AngularVelocity = tracker.AngularVelocity.GetValueOrDefault().ComVector00(),
+            AngularAcceleration = tracker.AngularAcceleration.GetValueOrDefault().ComVector00(),
+            Timestamp = SteadyTimestamp()
+        };
+    }
+
+    // Steady clock microseconds, same QPC source as the driver's std::chrono::steady_clock
+    public static long SteadyTimestamp()
+    {
+        return (long)(Stopwatch.GetTimestamp() * (1_000_000.0 / Stopwatch.Frequency));
+    }
+
     public static driver_Amethyst.dVector3 ComVector(this Vector3 v)
     {
         return new driver_Amethyst.dVector3 { X = v.X, Y = v.Y, Z = v.Z };
@@ -1,10 +1,23 @@
 ﻿using System;
 using System.Runtime.InteropServices;
+using driver_Amethyst = com.driver_Amethyst;
+using driver_00Amethyst = com.driver_00Amethyst;
 
 namespace plugin_OpenVR.Utils;
 
 public class DriverHelper
 {
+    // TAP_API_VERSION (Common/constants.hpp) of the driver interfaces this plugin was built against
+    public const uint DriverApiVersion = 3;
+
+    public static uint GetDriverApiVersion(object service, bool emulated)
+    {
+        uint version;
+        if (emulated) ((driver_00Amethyst.IVersionedApi)service).GetVersion(out version);
+        else ((driver_Amethyst.IVersionedApi)service).GetVersion(out version);
+        return version;
+    }
+
     public static int InstallDriverProxyStub(bool emulated)
     {
         return emulated ? Methods00.InstallProxyStub() : Methods.InstallProxyStub();
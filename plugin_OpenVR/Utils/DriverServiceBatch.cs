@@ -0,0 +1,89 @@
+﻿using System.Runtime.InteropServices;
+using driver_Amethyst = com.driver_Amethyst;
+using driver_00Amethyst = com.driver_00Amethyst;
+
+namespace plugin_OpenVR.Utils;
+
+// tlbimp imports [size_is] pointers as a single 'ref' element, so the array methods of
+// IDriverService (IDriverService.idl) are declared here by hand. The vtable is positional:
+// every method up to the last one used has to be listed, in IDL order. The array methods were
+// appended last so the vtable of the earlier methods is unchanged for existing clients.
+
+[ComImport, Guid("73B047A0-40A4-4D23-A5D3-5F7A87156E12"), InterfaceType(ComInterfaceType.InterfaceIsIUnknown)]
+public interface IDriverServiceBatch
+{
+    void SetTrackerState(driver_Amethyst.dTrackerBase tracker);
+    void UpdateTracker(driver_Amethyst.dTrackerBase tracker);
+
+    void RequestVrRestart([MarshalAs(UnmanagedType.LPWStr)] string message);
+    void PingDriverService(out long ms);
+
+    // S_FALSE if any element failed, see results
+    [PreserveSig]
+    int SetTrackerStateVector(uint count,
+        [In, MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 0)] driver_Amethyst.dTrackerBase[] trackers,
+        [Out, MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 0)] int[] results);
+
+    [PreserveSig]
+    int UpdateTrackerVector(uint count,
+        [In, MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 0)] driver_Amethyst.dTrackerBase[] trackers,
+        [Out, MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 0)] int[] results);
+}
+
+[ComImport, Guid("73B047A0-40A4-4D23-A5D3-5F7A87156E12"), InterfaceType(ComInterfaceType.InterfaceIsIUnknown)]
+public interface IDriverServiceBatch00
+{
+    void SetTrackerState(driver_00Amethyst.dTrackerBase tracker);
+    void UpdateTracker(driver_00Amethyst.dTrackerBase tracker);
+
+    void RequestVrRestart([MarshalAs(UnmanagedType.LPWStr)] string message);
+    void PingDriverService(out long ms);
+
+    void SetDriverPose(uint id, driver_00Amethyst.dDriverPose pose);
+    void EnableOverride(uint id, sbyte isEnabled);
+
+    void UpdateInputBoolean(driver_00Amethyst.dTrackerType tracker, [MarshalAs(UnmanagedType.LPWStr)] string path, sbyte value);
+    void UpdateInputScalar(driver_00Amethyst.dTrackerType tracker, [MarshalAs(UnmanagedType.LPWStr)] string path, float value);
+
+    void RegisterInputAction(driver_00Amethyst.dTrackerType tracker, [MarshalAs(UnmanagedType.LPWStr)] string path, out uint token);
+    void UpdateInputBooleanToken(driver_00Amethyst.dTrackerType tracker, uint token, sbyte value);
+    void UpdateInputScalarToken(driver_00Amethyst.dTrackerType tracker, uint token, float value);
+
+    [PreserveSig]
+    int UpdateInputVector(driver_00Amethyst.dTrackerType tracker, long timestamp, uint count,
+        [In, MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 2)] driver_00Amethyst.dInputUpdate[] updates,
+        [Out, MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 2)] int[] results);
+
+    void UpdateSkeleton(driver_00Amethyst.dTrackerType tracker, ref driver_00Amethyst.dSkeletonPose skeleton);
+    void PollHapticEvents(uint capacity,
+        [Out, MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 0)] driver_00Amethyst.dHapticEvent[] events, out uint count);
+
+    void SetWorldFromDriverTransform(driver_00Amethyst.dVector3 translation, driver_00Amethyst.dQuaternion rotation);
+
+    void UpdateTrackerCompact(driver_00Amethyst.dPoseSample pose);
+
+    [PreserveSig]
+    int UpdateTrackerQuantizedVector(long timestamp, driver_00Amethyst.dVector3 origin, uint count,
+        [In, MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 2)] driver_00Amethyst.dQuantizedPose[] poses,
+        [Out, MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 2)] int[] results);
+
+    // No per-pose results, rejections are counted driver-side (GetSubmissionStats)
+    void SubmitTrackerPoses(uint count,
+        [In, MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 0)] driver_00Amethyst.dPoseSample[] poses);
+    void GetSubmissionStats(out driver_00Amethyst.dSubmissionStats stats);
+
+    void ProbeLatency(out long received, out long replied);
+    void GetPoseLatency(driver_00Amethyst.dTrackerType tracker, driver_00Amethyst.dPoseTransport transport,
+        out driver_00Amethyst.dLatencyStats arrival, out driver_00Amethyst.dLatencyStats consumption);
+
+    // S_FALSE if any element failed, see results
+    [PreserveSig]
+    int SetTrackerStateVector(uint count,
+        [In, MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 0)] driver_00Amethyst.dTrackerBase[] trackers,
+        [Out, MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 0)] int[] results);
+
+    [PreserveSig]
+    int UpdateTrackerVector(uint count,
+        [In, MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 0)] driver_00Amethyst.dTrackerBase[] trackers,
+        [Out, MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 0)] int[] results);
+}
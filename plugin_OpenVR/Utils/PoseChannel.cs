@@ -0,0 +1,181 @@
+using System;
+using System.IO.MemoryMappedFiles;
+using System.Threading;
+using Amethyst.Plugins.Contract;
+
+namespace plugin_OpenVR.Utils;
+
+// Client side of the driver's shared memory pose transport (driver_00Amethyst/PoseChannel.h)
+internal unsafe class PoseChannel : IDisposable
+{
+    private const string ChannelName = "Local\\AmethystPoseChannel";
+    private const uint ChannelMagic = 0x4C484350;
+    private const uint ChannelVersion = 3;
+
+    private const int HeaderSize = 64;
+    private const int HeartbeatOffset = 16;
+    private const int SlotSize = 128;
+    private const int SlotCount = 16;
+
+    // Same as k_pose_channel_heartbeat_timeout_us: past this, the driver isn't reading
+    private const long HeartbeatTimeoutUs = 500_000;
+
+    // Spins on an unchanged odd sequence before treating it as a writer that died mid-write
+    private const int MaxStalledSpins = 1000;
+
+    private const uint FlagTrackingState = 1 << 0;
+    private const uint FlagHasVelocity = 1 << 1;
+    private const uint FlagHasAngularVelocity = 1 << 2;
+    private const uint FlagHasAcceleration = 1 << 3;
+    private const uint FlagHasAngularAcceleration = 1 << 4;
+
+    private MemoryMappedFile _file;
+    private MemoryMappedViewAccessor _view;
+    private byte* _base;
+
+    private PoseChannel()
+    {
+    }
+
+    public static PoseChannel TryOpen()
+    {
+        var channel = new PoseChannel();
+        try
+        {
+            channel._file = MemoryMappedFile.OpenExisting(ChannelName, MemoryMappedFileRights.ReadWrite);
+            channel._view = channel._file.CreateViewAccessor(0, HeaderSize + SlotSize * SlotCount);
+            channel._view.SafeMemoryMappedViewHandle.AcquirePointer(ref channel._base);
+            channel._base += channel._view.PointerOffset;
+
+            // Validate the layout published by the driver
+            var header = (uint*)channel._base;
+            if (Volatile.Read(ref header[0]) == ChannelMagic && header[1] == ChannelVersion &&
+                header[2] == SlotCount && header[3] == SlotSize) return channel;
+        }
+        catch (Exception)
+        {
+            // Not available, the caller falls back to COM
+        }
+
+        channel.Dispose();
+        return null;
+    }
+
+    public bool TryWrite(TrackerBase tracker, bool allowInferred)
+    {
+        var role = (int)tracker.Role;
+        if (_base == null || role is < 0 or >= SlotCount || !IsDriverAlive) return false;
+
+        var slot = _base + HeaderSize + SlotSize * role;
+        var sequence = (uint*)slot;
+        var sample = (float*)(slot + 20); // Skip the sequence, the timestamp and the flags
+
+        var flags = (allowInferred
+                        ? tracker.TrackingState is not TrackedJointState.StateNotTracked
+                        : tracker.TrackingState is TrackedJointState.StateTracked)
+                        ? FlagTrackingState
+                        : 0;
+
+        if (tracker.Velocity.HasValue) flags |= FlagHasVelocity;
+        if (tracker.Acceleration.HasValue) flags |= FlagHasAcceleration;
+        if (tracker.AngularVelocity.HasValue) flags |= FlagHasAngularVelocity;
+        if (tracker.AngularAcceleration.HasValue) flags |= FlagHasAngularAcceleration;
+
+        // Odd sequence: write in progress. Claim it with a CAS like Util::seqlock::store,
+        // so concurrent writers (in any process) serialize instead of interleaving
+        var seq = ClaimSlot(sequence);
+        Thread.MemoryBarrier();
+
+        *(long*)(slot + 8) = OvrExtensions.SteadyTimestamp();
+        *(uint*)(slot + 16) = flags;
+
+        sample[0] = tracker.Position.X;
+        sample[1] = tracker.Position.Y;
+        sample[2] = tracker.Position.Z;
+
+        sample[3] = tracker.Orientation.X;
+        sample[4] = tracker.Orientation.Y;
+        sample[5] = tracker.Orientation.Z;
+        sample[6] = tracker.Orientation.W;
+
+        var velocity = tracker.Velocity.GetValueOrDefault();
+        sample[7] = velocity.X;
+        sample[8] = velocity.Y;
+        sample[9] = velocity.Z;
+
+        var acceleration = tracker.Acceleration.GetValueOrDefault();
+        sample[10] = acceleration.X;
+        sample[11] = acceleration.Y;
+        sample[12] = acceleration.Z;
+
+        var angularVelocity = tracker.AngularVelocity.GetValueOrDefault();
+        sample[13] = angularVelocity.X;
+        sample[14] = angularVelocity.Y;
+        sample[15] = angularVelocity.Z;
+
+        var angularAcceleration = tracker.AngularAcceleration.GetValueOrDefault();
+        sample[16] = angularAcceleration.X;
+        sample[17] = angularAcceleration.Y;
+        sample[18] = angularAcceleration.Z;
+
+        // Even sequence: sample published
+        Volatile.Write(ref *sequence, seq + 2);
+        return true;
+    }
+
+    // The driver bumps the heartbeat every frame and clears it when it closes the channel,
+    // a stale one means nobody reads the slots (SteamVR gone or hung): use COM instead
+    private bool IsDriverAlive
+    {
+        get
+        {
+            var heartbeat = Volatile.Read(ref *(long*)(_base + HeartbeatOffset));
+            return heartbeat != 0 && OvrExtensions.SteadyTimestamp() - heartbeat < HeartbeatTimeoutUs;
+        }
+    }
+
+    // Even -> odd, returns the claimed (even) sequence
+    private static uint ClaimSlot(uint* sequence)
+    {
+        var spinner = new SpinWait();
+        var seq = Volatile.Read(ref *sequence);
+        var stalled = 0;
+
+        while (true)
+        {
+            if ((seq & 1) == 0)
+            {
+                var current = Interlocked.CompareExchange(ref *sequence, seq + 1, seq);
+                if (current == seq) return seq;
+                seq = current;
+                stalled = 0;
+                continue;
+            }
+
+            // Another write in flight: wait for it, unless it's been odd for too long
+            // (a writer that died mid-write), then take the slot over (odd -> next odd)
+            spinner.SpinOnce();
+            var current = Volatile.Read(ref *sequence);
+            if (current != seq)
+            {
+                seq = current;
+                stalled = 0;
+            }
+            else if (++stalled > MaxStalledSpins &&
+                     Interlocked.CompareExchange(ref *sequence, seq + 2, seq) == seq)
+                return seq + 1;
+        }
+    }
+
+    public void Dispose()
+    {
+        if (_base != null)
+        {
+            _view.SafeMemoryMappedViewHandle.ReleasePointer();
+            _base = null;
+        }
+
+        _view?.Dispose();
+        _file?.Dispose();
+    }
+}
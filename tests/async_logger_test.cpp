@@ -0,0 +1,115 @@
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "async_logger.hpp"
+#include "check.hpp"
+
+namespace
+{
+    std::mutex g_sink_mutex;
+    std::vector<std::string> g_lines;
+    std::atomic<std::uint64_t> g_messages{0}, g_dropped{0};
+
+    void sink(const char* message)
+    {
+        // Drop reports carry the count of messages that never made it
+        if (constexpr char prefix[] = "["; std::strncmp(message, prefix, 1) == 0)
+        {
+            g_dropped.fetch_add(std::strtoull(message + 1, nullptr, 10));
+            return;
+        }
+
+        g_messages.fetch_add(1);
+        const std::scoped_lock lock(g_sink_mutex);
+        if (g_lines.size() < 16) g_lines.emplace_back(message);
+    }
+
+    void reset()
+    {
+        g_messages = g_dropped = 0;
+        g_lines.clear();
+    }
+
+    void direct_and_deferred()
+    {
+        Util::async_logger<16, 128> logger(&sink);
+
+        // Not started: written synchronously
+        logger.post("before start");
+        CHECK(g_messages == 1);
+
+        logger.start();
+#if __has_include(<format>)
+        logger.post("Tracker {} rejected, {} samples", 3, 2.5);
+#else
+        logger.post("Tracker 3 rejected, 2.5 samples");
+#endif
+        logger.post(std::string_view("a message that is longer than the record and gets truncated at 127 "
+                                     "characters, which is the record size minus the terminating zero byte"));
+        logger.stop();
+
+        CHECK(g_messages == 3);
+        CHECK(g_lines.size() == 3 && g_lines[1] == "Tracker 3 rejected, 2.5 samples");
+        CHECK(g_lines.size() == 3 && g_lines[2].size() == 127);
+
+        // Stopped: written synchronously again, and it can be restarted
+        logger.post("after stop");
+        CHECK(g_messages == 4);
+        logger.start();
+        logger.post("restarted");
+        logger.stop();
+        CHECK(g_messages == 5);
+    }
+
+    // Producers racing with stop(): every post is either written (queued or
+    // directly) or reported as dropped, none is left behind in the ring
+    template <typename Post>
+    void stop_while_posting(Post&& post)
+    {
+        constexpr std::uint32_t producers = 4, per_producer = 50000;
+
+        for (auto round = 0; round < 5; round++)
+        {
+            reset();
+            Util::async_logger<64, 64> logger(&sink);
+            logger.start();
+
+            std::vector<std::thread> threads;
+            for (std::uint32_t p = 0; p < producers; p++)
+                threads.emplace_back([&, p]
+                {
+                    for (std::uint32_t i = 0; i < per_producer; i++)
+                        post(logger, p, i);
+                });
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(round));
+            logger.stop();
+            for (auto& thread : threads)
+                thread.join();
+
+            CHECK(g_messages + g_dropped == std::uint64_t{producers} * per_producer);
+        }
+    }
+}
+
+int main()
+{
+    direct_and_deferred();
+    stop_while_posting([](auto& logger, std::uint32_t, std::uint32_t)
+    {
+        logger.post(std::string_view("producer message"));
+    });
+#if __has_include(<format>)
+    stop_while_posting([](auto& logger, const std::uint32_t p, const std::uint32_t i)
+    {
+        logger.post("producer {} message {}", p, i);
+    });
+#endif
+    return test_result();
+}
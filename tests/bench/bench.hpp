@@ -0,0 +1,45 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// Minimal benchmark harness: ns/op and heap allocations/op, one line per case.
+// Allocations are counted by the operator new replacement in bench_main.cpp.
+namespace bench
+{
+    inline std::atomic<std::uint64_t> g_allocations{0};
+    inline bool g_quick = false; // Smoke run from CTest
+
+    // Keep a value alive without the optimizer seeing through it
+    template <typename T>
+    void keep(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "g"(&value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    template <typename Body>
+    void run(const char* name, Body&& body, std::uint64_t iterations = 2'000'000)
+    {
+        if (g_quick) iterations = 1000;
+
+        for (std::uint64_t i = 0; i < iterations / 10 + 1; i++) body(i); // Warm up
+
+        const auto allocations = g_allocations.load(std::memory_order_relaxed);
+        const auto start = std::chrono::steady_clock::now();
+        for (std::uint64_t i = 0; i < iterations; i++) body(i);
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        const auto ns = std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(iterations);
+        const auto allocs = static_cast<double>(g_allocations.load(std::memory_order_relaxed) - allocations) /
+            static_cast<double>(iterations);
+        std::printf("%-52s %10.2f ns/op %8.3f allocs/op\n", name, ns, allocs);
+    }
+}
@@ -0,0 +1,35 @@
+#include <cstdlib>
+#include <new>
+
+#include "bench.hpp"
+
+void run_frame_benchmarks();
+void run_pose_benchmarks();
+void run_transport_benchmarks();
+
+void* operator new(const std::size_t size)
+{
+    bench::g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+int main(const int argc, char** argv)
+{
+    bench::g_quick = argc > 1 && std::strcmp(argv[1], "--quick") == 0;
+
+    run_transport_benchmarks();
+    run_pose_benchmarks();
+    run_frame_benchmarks();
+    return 0;
+}
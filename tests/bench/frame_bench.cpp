@@ -0,0 +1,234 @@
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define FRAME_BENCH_SSE2
+#endif
+
+#include "bench.hpp"
+
+// Per-frame pose math over all trackers, array-of-structs (what BodyTracker
+// holds) against structure-of-arrays (what a batched SIMD store would hold),
+// and the cost of walking the tracker map itself.
+//
+// Why BodyTracker stays array-of-structs behind a std::map (g++ 12 -O3, x86-64,
+// median of 9 runs, ns/op):
+//   15 trackers:   AoS 185, SoA 247, SoA SSE2 131
+//   1024 trackers: AoS 14234, SoA 18323, SoA SSE2 9619
+//   tracker walk:  std::map 97, pointer table 13
+// At the 15 trackers the driver supports, the whole frame is well under 1us of
+// an 11ms (90Hz) frame, far below one TrackedDevicePoseUpdated call per tracker.
+namespace
+{
+    struct world_transform
+    {
+        double rotation[4] = {0.92387953, 0.0, 0.38268343, 0.0}; // w, x, y, z
+        double translation[3] = {0.5, 0.0, -1.0};
+    };
+
+    struct pose_aos
+    {
+        double position[3];
+        double rotation[4]; // w, x, y, z
+        double velocity[3];
+        double submitted[3];
+        bool changed;
+    };
+
+    struct pose_soa
+    {
+        explicit pose_soa(const std::size_t count) :
+            px(count), py(count), pz(count), qw(count), qx(count), qy(count), qz(count),
+            vx(count), vy(count), vz(count), sx(count), sy(count), sz(count), changed(count)
+        {
+        }
+
+        std::vector<double> px, py, pz, qw, qx, qy, qz, vx, vy, vz, sx, sy, sz;
+        std::vector<std::uint8_t> changed;
+    };
+
+    // Normalize, move into the world frame, extrapolate, compare with the last submitted pose
+    void frame_aos(std::vector<pose_aos>& poses, const world_transform& world, const double dt)
+    {
+        const auto& [w, x, y, z] = world.rotation;
+        for (auto& pose : poses)
+        {
+            auto& q = pose.rotation;
+            const auto inv = 1.0 / std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+            for (auto& c : q) c *= inv;
+
+            double p[3];
+            for (auto i = 0; i < 3; i++)
+                p[i] = pose.position[i] + pose.velocity[i] * dt;
+
+            // v' = v + 2w(u x v) + 2u x (u x v), u = (x, y, z)
+            const double t[3] = {2 * (y * p[2] - z * p[1]), 2 * (z * p[0] - x * p[2]), 2 * (x * p[1] - y * p[0])};
+            const double r[3] = {
+                p[0] + w * t[0] + (y * t[2] - z * t[1]) + world.translation[0],
+                p[1] + w * t[1] + (z * t[0] - x * t[2]) + world.translation[1],
+                p[2] + w * t[2] + (x * t[1] - y * t[0]) + world.translation[2]
+            };
+
+            pose.changed = r[0] != pose.submitted[0] || r[1] != pose.submitted[1] || r[2] != pose.submitted[2];
+            for (auto i = 0; i < 3; i++) pose.submitted[i] = r[i];
+        }
+    }
+
+    void frame_soa(pose_soa& s, const std::size_t count, const world_transform& world, const double dt)
+    {
+        const auto [w, x, y, z] = world.rotation;
+        const auto [tx, ty, tz] = world.translation;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const auto inv = 1.0 / std::sqrt(s.qw[i] * s.qw[i] + s.qx[i] * s.qx[i] + s.qy[i] * s.qy[i] + s.qz[i] * s.qz[i]);
+            s.qw[i] *= inv;
+            s.qx[i] *= inv;
+            s.qy[i] *= inv;
+            s.qz[i] *= inv;
+
+            const auto p0 = s.px[i] + s.vx[i] * dt, p1 = s.py[i] + s.vy[i] * dt, p2 = s.pz[i] + s.vz[i] * dt;
+            const auto t0 = 2 * (y * p2 - z * p1), t1 = 2 * (z * p0 - x * p2), t2 = 2 * (x * p1 - y * p0);
+            const auto r0 = p0 + w * t0 + (y * t2 - z * t1) + tx;
+            const auto r1 = p1 + w * t1 + (z * t0 - x * t2) + ty;
+            const auto r2 = p2 + w * t2 + (x * t1 - y * t0) + tz;
+
+            s.changed[i] = (r0 != s.sx[i]) | (r1 != s.sy[i]) | (r2 != s.sz[i]);
+            s.sx[i] = r0;
+            s.sy[i] = r1;
+            s.sz[i] = r2;
+        }
+    }
+
+#ifdef FRAME_BENCH_SSE2
+    // Same as frame_soa, two trackers per iteration (count must be even)
+    void frame_soa_sse2(pose_soa& s, const std::size_t count, const world_transform& world, const double dt)
+    {
+        const auto w = _mm_set1_pd(world.rotation[0]), x = _mm_set1_pd(world.rotation[1]),
+                   y = _mm_set1_pd(world.rotation[2]), z = _mm_set1_pd(world.rotation[3]);
+        const auto tx = _mm_set1_pd(world.translation[0]), ty = _mm_set1_pd(world.translation[1]),
+                   tz = _mm_set1_pd(world.translation[2]);
+        const auto vdt = _mm_set1_pd(dt), two = _mm_set1_pd(2.0), one = _mm_set1_pd(1.0);
+
+        const auto mul = [](const __m128d a, const __m128d b) { return _mm_mul_pd(a, b); };
+        const auto add = [](const __m128d a, const __m128d b) { return _mm_add_pd(a, b); };
+        const auto sub = [](const __m128d a, const __m128d b) { return _mm_sub_pd(a, b); };
+
+        for (std::size_t i = 0; i < count; i += 2)
+        {
+            auto qw = _mm_loadu_pd(&s.qw[i]), qx = _mm_loadu_pd(&s.qx[i]),
+                 qy = _mm_loadu_pd(&s.qy[i]), qz = _mm_loadu_pd(&s.qz[i]);
+            const auto inv = _mm_div_pd(one, _mm_sqrt_pd(
+                                            add(add(mul(qw, qw), mul(qx, qx)), add(mul(qy, qy), mul(qz, qz)))));
+            _mm_storeu_pd(&s.qw[i], mul(qw, inv));
+            _mm_storeu_pd(&s.qx[i], mul(qx, inv));
+            _mm_storeu_pd(&s.qy[i], mul(qy, inv));
+            _mm_storeu_pd(&s.qz[i], mul(qz, inv));
+
+            const auto p0 = add(_mm_loadu_pd(&s.px[i]), mul(_mm_loadu_pd(&s.vx[i]), vdt));
+            const auto p1 = add(_mm_loadu_pd(&s.py[i]), mul(_mm_loadu_pd(&s.vy[i]), vdt));
+            const auto p2 = add(_mm_loadu_pd(&s.pz[i]), mul(_mm_loadu_pd(&s.vz[i]), vdt));
+
+            const auto t0 = mul(two, sub(mul(y, p2), mul(z, p1)));
+            const auto t1 = mul(two, sub(mul(z, p0), mul(x, p2)));
+            const auto t2 = mul(two, sub(mul(x, p1), mul(y, p0)));
+            const auto r0 = add(add(add(p0, mul(w, t0)), sub(mul(y, t2), mul(z, t1))), tx);
+            const auto r1 = add(add(add(p1, mul(w, t1)), sub(mul(z, t0), mul(x, t2))), ty);
+            const auto r2 = add(add(add(p2, mul(w, t2)), sub(mul(x, t1), mul(y, t0))), tz);
+
+            const auto changed = _mm_movemask_pd(_mm_or_pd(
+                _mm_or_pd(_mm_cmpneq_pd(r0, _mm_loadu_pd(&s.sx[i])), _mm_cmpneq_pd(r1, _mm_loadu_pd(&s.sy[i]))),
+                _mm_cmpneq_pd(r2, _mm_loadu_pd(&s.sz[i]))));
+            s.changed[i] = changed & 1;
+            s.changed[i + 1] = changed >> 1 & 1;
+
+            _mm_storeu_pd(&s.sx[i], r0);
+            _mm_storeu_pd(&s.sy[i], r1);
+            _mm_storeu_pd(&s.sz[i], r2);
+        }
+    }
+#endif
+
+    void pose_kernels(const std::size_t count)
+    {
+        const world_transform world;
+
+        std::vector<pose_aos> aos(count);
+        pose_soa soa(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const auto v = static_cast<double>(i) * 0.01;
+            aos[i] = {{v, 1.0, -v}, {1.0, 0.01, 0.02, 0.03}, {0.1, 0.0, 0.2}, {}, false};
+            soa.px[i] = v, soa.py[i] = 1.0, soa.pz[i] = -v;
+            soa.qw[i] = 1.0, soa.qx[i] = 0.01, soa.qy[i] = 0.02, soa.qz[i] = 0.03;
+            soa.vx[i] = 0.1, soa.vy[i] = 0.0, soa.vz[i] = 0.2;
+        }
+
+        const auto iterations = count > 100 ? 20'000 : 1'000'000;
+        char name[64];
+
+        std::snprintf(name, sizeof(name), "pose kernel, %zu trackers: array of structs", count);
+        bench::run(name, [&](const std::uint64_t i)
+        {
+            frame_aos(aos, world, 1e-3 * static_cast<double>(i & 7));
+            bench::keep(aos);
+        }, iterations);
+
+        std::snprintf(name, sizeof(name), "pose kernel, %zu trackers: structure of arrays", count);
+        bench::run(name, [&](const std::uint64_t i)
+        {
+            frame_soa(soa, count, world, 1e-3 * static_cast<double>(i & 7));
+            bench::keep(soa);
+        }, iterations);
+
+#ifdef FRAME_BENCH_SSE2
+        const auto padded = count + (count & 1);
+        pose_soa soa_sse2(padded);
+        for (std::size_t i = 0; i < padded; i++)
+            soa_sse2.qw[i] = 1.0; // Padding lanes stay valid
+
+        std::snprintf(name, sizeof(name), "pose kernel, %zu trackers: SoA, SSE2", count);
+        bench::run(name, [&](const std::uint64_t i)
+        {
+            frame_soa_sse2(soa_sse2, padded, world, 1e-3 * static_cast<double>(i & 7));
+            bench::keep(soa_sse2);
+        }, iterations);
+#endif
+    }
+
+    // RunFrame's walk: 15 trackers of BodyTracker's size in a std::map against a pointer table
+    void tracker_walk()
+    {
+        struct tracker
+        {
+            unsigned char state[1024]; // Roughly a BodyTracker (pose, filter, history, input handles)
+            std::uint64_t updated;
+        };
+
+        std::map<int, tracker> trackers;
+        std::vector<tracker*> table;
+        for (auto role = 0; role < 16; role++)
+            if (role != 13) table.push_back(&trackers[role]); // No TrackerHead
+
+        bench::run("RunFrame walk, 15 trackers: std::map", [&](const std::uint64_t i)
+        {
+            for (auto& [role, t] : trackers) t.updated = i;
+            bench::keep(trackers);
+        });
+        bench::run("RunFrame walk, 15 trackers: pointer table", [&](const std::uint64_t i)
+        {
+            for (const auto t : table) t->updated = i;
+            bench::keep(table);
+        });
+    }
+}
+
+void run_frame_benchmarks()
+{
+    tracker_walk();
+    pose_kernels(15);
+    pose_kernels(1024);
+}
@@ -0,0 +1,102 @@
+#include <cmath>
+#include <cstdint>
+
+#include "bench.hpp"
+#include "DataContract.h"
+#include "PoseEstimator.h"
+#include "PoseFilter.h"
+#include "PoseHistory.h"
+#include "QuantizedPose.h"
+
+namespace
+{
+    vr::HmdQuaternion_t rotation_at(const double t)
+    {
+        return {std::cos(t * 0.5), 0.0, std::sin(t * 0.5), 0.0};
+    }
+
+    void pose_processing()
+    {
+        PoseEstimator estimator;
+        bench::run("PoseEstimator::update", [&](const std::uint64_t i)
+        {
+            const auto t = static_cast<double>(i) * 0.01;
+            const double position[3] = {std::sin(t), 1.0, 0.0};
+            double velocity[3], angular_velocity[3];
+            estimator.update(position, rotation_at(t), t, velocity, angular_velocity);
+            bench::keep(velocity);
+        });
+
+        PoseFilterChain<OneEuroPoseFilter> filter;
+        bench::run("PoseFilterChain<OneEuroPoseFilter>::apply", [&](const std::uint64_t i)
+        {
+            const auto t = static_cast<double>(i) * 0.01;
+            PoseFilterSample sample{{std::sin(t), 1.0, 0.0}, rotation_at(t), t};
+            filter.apply(sample);
+            bench::keep(sample);
+        });
+
+        PoseHistory history;
+        bench::run("PoseHistory push + sample (interpolated)", [&](const std::uint64_t i)
+        {
+            const auto time = static_cast<long long>(i) * 10'000;
+            history.push({{std::sin(static_cast<double>(i)), 1.0, 0.0}, rotation_at(static_cast<double>(i)),
+                          {1.0, 0.0, 0.0}, true, time});
+            PoseHistorySample out;
+            history.sample(time - 15'000, out);
+            bench::keep(out);
+        });
+    }
+
+    void pose_decoding()
+    {
+        dTrackerBase tracker{};
+        tracker.TrackingState = true;
+        tracker.Role = TrackerWaist;
+        tracker.Position = {0.1f, 1.f, -0.3f};
+        tracker.Orientation = {0.f, 0.38268343f, 0.f, 0.92387953f};
+        tracker.Velocity = {true, {0.5f, 0.f, -0.25f}};
+        tracker.AngularVelocity = {true, {0.f, 1.5f, 0.f}};
+
+        const dVector3 origin{0.f, 1.f, 0.f};
+        dQuantizedPose quantized[16];
+        for (auto& pose : quantized)
+            pose = encode_quantized_pose(tracker, origin);
+
+        bench::run("decode_quantized_pose x16", [&](const std::uint64_t i)
+        {
+            for (const auto& pose : quantized)
+                bench::keep(decode_quantized_pose(pose, origin, static_cast<long long>(i)));
+        }, 500'000);
+
+        std::uint16_t halves[12];
+        for (std::uint16_t i = 0; i < 12; i++)
+            halves[i] = float_to_half(static_cast<float>(i) * 0.37f);
+        float values[12];
+
+        bench::run("decode_halves x12: scalar", [&](std::uint64_t)
+        {
+            decode_halves_scalar(halves, values, 12);
+            bench::keep(values);
+        });
+#ifdef AME_QUANTIZED_POSE_F16C
+        if (g_cpu_supports_f16c)
+            bench::run("decode_halves x12: F16C", [&](std::uint64_t)
+            {
+                decode_halves_f16c(halves, values, 12);
+                bench::keep(values);
+            });
+#endif
+
+        bench::run("encode_quantized_pose", [&](std::uint64_t)
+        {
+            bench::keep(encode_quantized_pose(tracker, origin));
+        });
+    }
+}
+
+void run_pose_benchmarks()
+{
+    pose_processing();
+    pose_decoding();
+}
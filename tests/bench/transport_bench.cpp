@@ -0,0 +1,133 @@
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "bench.hpp"
+#include "DataContract.h"
+#include "InputActions.h"
+#include "PoseOverrideTable.h"
+#include "util/async_logger.hpp"
+#include "util/latest_mailbox.hpp"
+#include "util/mpsc_ring.hpp"
+#include "util/seqlock.hpp"
+
+namespace
+{
+    dTrackerBase make_tracker(const std::uint64_t i)
+    {
+        dTrackerBase tracker{};
+        tracker.Role = TrackerWaist;
+        tracker.Position = {static_cast<float>(i % 100) * 0.01f, 1.f, 0.f};
+        tracker.Orientation = {0.f, 0.f, 0.f, 1.f};
+        tracker.Timestamp = static_cast<long long>(i);
+        return tracker;
+    }
+
+    void pose_publishing()
+    {
+        Util::seqlock<dTrackerBase> lock;
+        bench::run("seqlock<dTrackerBase> store", [&](const std::uint64_t i) { lock.store(make_tracker(i)); });
+        bench::run("seqlock<dTrackerBase> load", [&](std::uint64_t)
+        {
+            bench::keep(lock.load());
+        });
+
+        Util::latest_mailbox<dTrackerBase> mailbox;
+        bench::run("latest_mailbox post + take", [&](const std::uint64_t i)
+        {
+            mailbox.post(make_tracker(i));
+            dTrackerBase out;
+            bench::keep(mailbox.take(out));
+        });
+        bench::run("latest_mailbox take (nothing pending)", [&](std::uint64_t)
+        {
+            dTrackerBase out;
+            bench::keep(mailbox.take(out));
+        });
+    }
+
+    void log_queue()
+    {
+        Util::mpsc_ring<std::uint64_t[64], 256> ring;
+        bench::run("mpsc_ring<512B> push + pop", [&](const std::uint64_t i)
+        {
+            ring.try_push([i](std::uint64_t (&r)[64]) { r[0] = i; });
+            ring.try_pop([](const std::uint64_t (&r)[64]) { bench::keep(r[0]); });
+        });
+
+#if __has_include(<format>)
+        static std::uint64_t sunk = 0;
+        Util::async_logger<> logger([](const char*) { sunk++; });
+        logger.start();
+        bench::run("async_logger post (deferred format)", [&](const std::uint64_t i)
+        {
+            logger.post("Tracker {} pose rejected: {}", static_cast<int>(i % 16), i);
+        }, 200'000);
+        logger.stop();
+#endif
+    }
+
+    // The old lookup: a std::map keyed by std::string, built from the same tables
+    void input_lookup()
+    {
+        std::map<std::string, int> actions;
+        for (std::size_t i = 0; i < k_input_actions.size(); i++)
+            actions.emplace(k_input_actions[i].guid, static_cast<int>(i));
+
+        const std::string guid = "14E62950-A538-422E-B688-82CCB5B1E179";
+        bench::run("input action lookup: std::map<std::string>", [&](std::uint64_t)
+        {
+            bench::keep(actions.find(guid)->second);
+        });
+        bench::run("input action lookup: std::map (temporary key)", [&](std::uint64_t)
+        {
+            bench::keep(actions.find(std::string(guid.data(), guid.size()))->second);
+        });
+        bench::run("input action lookup: compile-time perfect hash", [&](std::uint64_t)
+        {
+            bench::keep(find_input_action(guid));
+        });
+    }
+
+    // HandleDevicePoseUpdated for every device ID, with 0, 1 and 64 overrides enabled
+    void pose_overrides()
+    {
+        for (const std::uint32_t enabled : {0u, 1u, 64u})
+        {
+            std::map<std::uint32_t, dDriverPose> map;
+            auto table = std::make_unique<PoseOverrideTable>();
+            for (std::uint32_t id = 0; id < enabled; id++)
+            {
+                map[id] = dDriverPose{1, 1, {1, 2, 3}, {0, 0, 0, 1}};
+                table->set_enabled(id, true);
+                table->set_pose(id, map[id]);
+            }
+
+            char name[64];
+            std::snprintf(name, sizeof(name), "override lookup x64: std::map, %u enabled", enabled);
+            bench::run(name, [&](std::uint64_t)
+            {
+                for (std::uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+                    if (map.contains(id)) bench::keep(map[id]);
+            }, 200'000);
+
+            std::snprintf(name, sizeof(name), "override lookup x64: PoseOverrideTable, %u enabled", enabled);
+            bench::run(name, [&](std::uint64_t)
+            {
+                dDriverPose pose;
+                for (std::uint32_t id = 0; id < vr::k_unMaxTrackedDeviceCount; id++)
+                    if (table->try_get(id, pose)) bench::keep(pose);
+            }, 200'000);
+        }
+    }
+}
+
+void run_transport_benchmarks()
+{
+    pose_publishing();
+    log_queue();
+    input_lookup();
+    pose_overrides();
+}
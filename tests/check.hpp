@@ -0,0 +1,32 @@
+#pragma once
+#include <cmath>
+#include <cstdio>
+
+// Minimal checks for the standalone tests: failures are reported and counted,
+// main() returns test_result() so CTest sees them.
+inline int g_check_failures = 0;
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            g_check_failures++; \
+        } \
+    } while (false)
+
+#define CHECK_NEAR(actual, expected, tolerance) \
+    do { \
+        const double check_actual_ = (actual), check_expected_ = (expected); \
+        if (!(std::abs(check_actual_ - check_expected_) <= (tolerance))) { \
+            std::fprintf(stderr, "%s:%d: CHECK_NEAR(%s, %s) failed: %g vs %g\n", __FILE__, __LINE__, \
+                         #actual, #expected, check_actual_, check_expected_); \
+            g_check_failures++; \
+        } \
+    } while (false)
+
+inline int test_result()
+{
+    if (g_check_failures > 0)
+        std::fprintf(stderr, "%d check(s) failed\n", g_check_failures);
+    return g_check_failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,46 @@
+#include "LatencyHistogram.h"
+#include "check.hpp"
+
+int main()
+{
+    LatencyHistogram histogram;
+    CHECK(histogram.count() == 0);
+    CHECK(histogram.percentile(0.5) == 0);
+
+    // Bucket bounds: 0 and 1 share bucket 0, then [2^i, 2^(i+1))
+    histogram.record(-5);
+    histogram.record(0);
+    histogram.record(1);
+    CHECK(histogram.count() == 3);
+    CHECK(histogram.percentile(1.0) == 1);
+
+    histogram.reset();
+    histogram.record(2);
+    histogram.record(3);
+    CHECK(histogram.percentile(1.0) == 3);
+    histogram.record(4);
+    CHECK(histogram.percentile(1.0) == 7);
+
+    // 99 fast samples and one slow one: the median stays low, the maximum doesn't
+    histogram.reset();
+    for (auto i = 0; i < 99; i++)
+        histogram.record(500); // [256, 512)
+    histogram.record(20000); // [16384, 32768)
+    CHECK(histogram.percentile(0.5) == 511);
+    CHECK(histogram.percentile(0.99) == 511);
+    CHECK(histogram.percentile(1.0) == 32767);
+
+    // Anything past the last bucket is clamped into it
+    histogram.reset();
+    histogram.record(1ll << 40);
+    CHECK(histogram.percentile(1.0) == (1ll << LatencyHistogram::bucket_count) - 1);
+
+    // Copies are snapshots
+    histogram.record(100);
+    const auto copy = histogram;
+    histogram.record(100);
+    CHECK(copy.count() == 2);
+    CHECK(histogram.count() == 3);
+
+    return test_result();
+}
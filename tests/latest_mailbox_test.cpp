@@ -0,0 +1,94 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "latest_mailbox.hpp"
+#include "check.hpp"
+
+namespace
+{
+    struct sample
+    {
+        std::uint64_t value;
+        std::uint64_t check; // ~value, a torn read breaks the pair
+    };
+
+    void single_thread()
+    {
+        Util::latest_mailbox<sample> mailbox;
+        sample out{};
+        CHECK(!mailbox.take(out));
+
+        mailbox.post({1, ~1ull});
+        CHECK(mailbox.take(out) && out.value == 1);
+        CHECK(!mailbox.take(out)); // Taken once only
+
+        // Latest wins, the others are counted
+        for (std::uint64_t i = 2; i <= 5; i++)
+            mailbox.post({i, ~i});
+        CHECK(mailbox.take(out) && out.value == 5);
+        CHECK(mailbox.overwritten() == 3);
+
+        // Copies keep the value and the count, with nothing pending
+        mailbox.post({6, ~6ull});
+        auto copy = mailbox;
+        CHECK(!copy.take(out));
+        CHECK(copy.overwritten() == 3);
+    }
+
+    // Three writers, one reader: every post is either taken or counted as
+    // overwritten, and no take returns a torn sample
+    void writers_reader()
+    {
+        constexpr std::uint32_t writers = 3, per_writer = 200000;
+        Util::latest_mailbox<sample> mailbox;
+
+        std::atomic<bool> done{false};
+        std::uint64_t taken = 0, torn = 0;
+
+        std::thread reader([&]
+        {
+            sample out;
+            const auto take = [&]
+            {
+                if (!mailbox.take(out)) return false;
+                taken++;
+                if (out.check != ~out.value) torn++;
+                return true;
+            };
+
+            while (!done.load()) take();
+            while (take())
+            {
+            }
+        });
+
+        std::vector<std::thread> threads;
+        for (std::uint32_t w = 0; w < writers; w++)
+            threads.emplace_back([&, w]
+            {
+                for (std::uint32_t i = 0; i < per_writer; i++)
+                {
+                    const auto value = std::uint64_t{w} << 32 | i;
+                    mailbox.post({value, ~value});
+                }
+            });
+
+        for (auto& thread : threads)
+            thread.join();
+        done.store(true);
+        reader.join();
+
+        CHECK(torn == 0);
+        CHECK(taken > 0);
+        CHECK(taken + mailbox.overwritten() == std::uint64_t{writers} * per_writer);
+    }
+}
+
+int main()
+{
+    single_thread();
+    writers_reader();
+    return test_result();
+}
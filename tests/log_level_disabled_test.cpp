@@ -0,0 +1,20 @@
+#define AME_LOG_VERBOSE 0
+#include "LogLevel.h"
+#include "check.hpp"
+
+// Declared only: this links because a compiled-out LOG_VERBOSE doesn't reference it
+void logMessageVerbose(const char* fmt, int value);
+
+int main()
+{
+    auto evaluated = 0;
+
+    // The runtime level can't turn it back on
+    g_log_level = LogLevel_Verbose;
+    CHECK(!isVerboseLoggingEnabled());
+
+    LOG_VERBOSE("value %d", ++evaluated);
+    CHECK(evaluated == 0);
+
+    return test_result();
+}
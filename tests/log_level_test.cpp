@@ -0,0 +1,43 @@
+#define AME_LOG_VERBOSE 1
+#include "LogLevel.h"
+#include "check.hpp"
+
+namespace
+{
+    int g_logged = 0, g_last_value = 0;
+
+    void logMessageVerbose(const char*, const int value)
+    {
+        g_logged++;
+        g_last_value = value;
+    }
+}
+
+int main()
+{
+    auto evaluated = 0;
+
+    // Compiled in but off at runtime: neither the call nor its arguments
+    CHECK(!isVerboseLoggingEnabled());
+    LOG_VERBOSE("value %d", ++evaluated);
+    CHECK(g_logged == 0);
+    CHECK(evaluated == 0);
+
+    g_log_level = LogLevel_Verbose;
+    CHECK(isVerboseLoggingEnabled());
+    LOG_VERBOSE("value %d", ++evaluated);
+    CHECK(g_logged == 1);
+    CHECK(g_last_value == 1);
+
+    // Usable as a single statement
+    if (evaluated > 0) LOG_VERBOSE("value %d", 42);
+    else CHECK(false);
+    CHECK(g_last_value == 42);
+
+    g_log_level = LogLevel_Info;
+    LOG_VERBOSE("value %d", ++evaluated);
+    CHECK(g_logged == 2);
+    CHECK(evaluated == 1);
+
+    return test_result();
+}
@@ -0,0 +1,97 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "mpsc_ring.hpp"
+#include "check.hpp"
+
+namespace
+{
+    void single_thread()
+    {
+        Util::mpsc_ring<int, 4> ring;
+        int value = 0;
+        CHECK(!ring.try_pop([&](const int& v) { value = v; }));
+
+        for (auto i = 0; i < 4; i++)
+            CHECK(ring.try_push([i](int& v) { v = i; }));
+        CHECK(!ring.try_push([](int& v) { v = 99; })); // Full
+
+        for (auto i = 0; i < 4; i++)
+        {
+            CHECK(ring.try_pop([&](const int& v) { value = v; }));
+            CHECK(value == i); // FIFO
+        }
+        CHECK(!ring.try_pop([&](const int& v) { value = v; }));
+
+        // Wraps around
+        for (auto round = 0; round < 10; round++)
+        {
+            CHECK(ring.try_push([round](int& v) { v = round; }));
+            CHECK(ring.try_pop([&](const int& v) { value = v; }));
+            CHECK(value == round);
+        }
+    }
+
+    // Several producers against one consumer: every accepted element comes out
+    // exactly once, in order per producer, and nothing is torn
+    void producers_consumer()
+    {
+        struct record
+        {
+            std::uint32_t producer;
+            std::uint32_t sequence;
+            std::uint64_t check;
+        };
+
+        constexpr std::uint32_t producers = 4, per_producer = 200000;
+        Util::mpsc_ring<record, 64> ring;
+
+        std::atomic<std::uint32_t> finished{0};
+        std::vector<std::thread> threads;
+        for (std::uint32_t p = 0; p < producers; p++)
+            threads.emplace_back([&, p]
+            {
+                for (std::uint32_t i = 0; i < per_producer; i++)
+                    while (!ring.try_push([&](record& r)
+                    {
+                        r = {p, i, (static_cast<std::uint64_t>(p) << 32 | i) * 0x9E3779B97F4A7C15ull};
+                    }))
+                        std::this_thread::yield();
+
+                finished.fetch_add(1);
+            });
+
+        std::uint32_t next[producers] = {};
+        std::uint64_t popped = 0, torn = 0, out_of_order = 0;
+        const auto consume = [&](const record& r)
+        {
+            if (r.check != (static_cast<std::uint64_t>(r.producer) << 32 | r.sequence) * 0x9E3779B97F4A7C15ull)
+                torn++;
+            else if (r.sequence != next[r.producer]++)
+                out_of_order++;
+            popped++;
+        };
+
+        while (finished.load() < producers)
+            if (!ring.try_pop(consume)) std::this_thread::yield();
+        while (ring.try_pop(consume))
+        {
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        CHECK(popped == std::uint64_t{producers} * per_producer);
+        CHECK(torn == 0);
+        CHECK(out_of_order == 0);
+    }
+}
+
+int main()
+{
+    single_thread();
+    producers_consumer();
+    return test_result();
+}
@@ -0,0 +1,99 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "DataContract.h"
+#include "PoseChannel.h"
+#include "check.hpp"
+
+// The client (plugin_OpenVR/Utils/PoseChannel.cs) writes the shared region
+// through raw offsets: these are the ones it uses
+namespace client
+{
+    constexpr std::size_t header_size = 64, heartbeat_offset = 16, slot_size = 128;
+    constexpr std::size_t timestamp_offset = 8, flags_offset = 16, floats_offset = 20; // From the slot start
+}
+
+static_assert(offsetof(PoseChannelLayout, slots) == client::header_size);
+static_assert(offsetof(PoseChannelHeader, heartbeat) == client::heartbeat_offset);
+static_assert(sizeof(PoseChannelLayout::slots[0]) == client::slot_size);
+static_assert(offsetof(Util::seqlock<PoseChannelSample>, value) + offsetof(PoseChannelSample, timestamp) ==
+    client::timestamp_offset);
+static_assert(offsetof(Util::seqlock<PoseChannelSample>, value) + offsetof(PoseChannelSample, flags) ==
+    client::flags_offset);
+static_assert(offsetof(Util::seqlock<PoseChannelSample>, value) + offsetof(PoseChannelSample, position) ==
+    client::floats_offset);
+static_assert(offsetof(PoseChannelSample, angular_acceleration) - offsetof(PoseChannelSample, position) ==
+    16 * sizeof(float));
+
+namespace
+{
+    // Same steps as PoseChannel.TryWrite: claim the sequence, fill, publish
+    void client_write(unsigned char* base, const std::size_t role, const std::int64_t timestamp,
+                      const std::uint32_t flags, const float (&values)[19])
+    {
+        auto* slot = base + client::header_size + client::slot_size * role;
+        auto& sequence = *reinterpret_cast<std::atomic<std::uint32_t>*>(slot);
+
+        auto seq = sequence.load() & ~1u;
+        while (!sequence.compare_exchange_weak(seq, seq + 1)) seq &= ~1u;
+
+        std::memcpy(slot + client::timestamp_offset, &timestamp, sizeof(timestamp));
+        std::memcpy(slot + client::flags_offset, &flags, sizeof(flags));
+        std::memcpy(slot + client::floats_offset, values, sizeof(values));
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+}
+
+int main()
+{
+    const auto layout = std::make_unique<PoseChannelLayout>();
+    auto* base = reinterpret_cast<unsigned char*>(layout.get());
+
+    float values[19];
+    for (auto i = 0; i < 19; i++)
+        values[i] = static_cast<float>(i) + 0.5f;
+
+    const auto flags = PoseFlag_TrackingState | PoseFlag_HasAcceleration | PoseFlag_HasAngularAcceleration;
+    client_write(base, TrackerWaist, 987654321, flags, values);
+
+    PoseChannelSample sample;
+    std::uint32_t version = 0;
+    CHECK(layout->slots[TrackerWaist].try_load(sample, &version));
+    CHECK(version == 2);
+    CHECK(sample.timestamp == 987654321);
+    CHECK(sample.flags == flags);
+    CHECK(sample.position[0] == values[0] && sample.position[2] == values[2]);
+    CHECK(sample.orientation[0] == values[3] && sample.orientation[3] == values[6]);
+    CHECK(sample.velocity[0] == values[7]);
+    CHECK(sample.acceleration[0] == values[10]);
+    CHECK(sample.angular_velocity[0] == values[13]);
+    CHECK(sample.angular_acceleration[0] == values[16] && sample.angular_acceleration[2] == values[18]);
+
+    // Neighbouring slots are untouched
+    CHECK(layout->slots[TrackerWaist - 1].version() == 0);
+    CHECK(layout->slots[TrackerWaist + 1].version() == 0);
+
+    // PoseChannel::open seeds the last read versions with version(): a sample written before
+    // is skipped, one being written while it opens still ends at a newer version
+    const auto seeded = layout->slots[TrackerWaist].version();
+    CHECK(seeded == version);
+
+    auto& sequence = *reinterpret_cast<std::atomic<std::uint32_t>*>(base + client::header_size +
+        client::slot_size * TrackerWaist);
+    sequence.fetch_add(1); // Client claimed the slot
+    const auto seeded_mid_write = layout->slots[TrackerWaist].version();
+    CHECK(seeded_mid_write == seeded);
+    sequence.fetch_add(1); // Published
+    CHECK(layout->slots[TrackerWaist].version() != seeded_mid_write);
+
+    // The heartbeat is read by the client as a plain 64-bit value
+    layout->header.heartbeat.store(123456789);
+    std::int64_t heartbeat;
+    std::memcpy(&heartbeat, base + client::heartbeat_offset, sizeof(heartbeat));
+    CHECK(heartbeat == 123456789);
+
+    return test_result();
+}
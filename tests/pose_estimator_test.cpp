@@ -0,0 +1,126 @@
+#include <cmath>
+
+#include "PoseEstimator.h"
+#include "check.hpp"
+
+namespace
+{
+    vr::HmdQuaternion_t multiply(const vr::HmdQuaternion_t& a, const vr::HmdQuaternion_t& b)
+    {
+        return {
+            a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z,
+            a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+            a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+            a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w
+        };
+    }
+
+    // Rotation by angle (rad) around the unit axis (x, y, z)
+    vr::HmdQuaternion_t axis_angle(const double x, const double y, const double z, const double angle)
+    {
+        const auto s = std::sin(angle / 2);
+        return {std::cos(angle / 2), x * s, y * s, z * s};
+    }
+}
+
+int main()
+{
+    double velocity[3], angular[3];
+    constexpr auto dt = 0.01; // 100Hz
+
+    // First sample: nothing to differentiate yet
+    {
+        PoseEstimator estimator(0.0);
+        estimator.update({1, 2, 3}, {1, 0, 0, 0}, 0.0, velocity, angular);
+        CHECK(velocity[0] == 0 && velocity[1] == 0 && velocity[2] == 0);
+        CHECK(angular[0] == 0 && angular[1] == 0 && angular[2] == 0);
+    }
+
+    // Constant linear and angular velocity (2 rad/s around world Y) are recovered exactly
+    {
+        PoseEstimator estimator(0.0);
+        for (auto i = 0; i <= 10; i++)
+        {
+            const auto t = i * dt;
+            estimator.update({0.5 * t, -0.25 * t, 0}, axis_angle(0, 1, 0, 2.0 * t), t, velocity, angular);
+        }
+
+        CHECK_NEAR(velocity[0], 0.5, 1e-9);
+        CHECK_NEAR(velocity[1], -0.25, 1e-9);
+        CHECK_NEAR(velocity[2], 0.0, 1e-9);
+        CHECK_NEAR(angular[0], 0.0, 1e-9);
+        CHECK_NEAR(angular[1], 2.0, 1e-9);
+        CHECK_NEAR(angular[2], 0.0, 1e-9);
+    }
+
+    // Angular velocity is in device space: spinning around the local Z of a device pitched by 90deg
+    {
+        PoseEstimator estimator(0.0);
+        const auto pitched = axis_angle(1, 0, 0, std::acos(-1.0) / 2);
+        for (auto i = 0; i <= 2; i++)
+            estimator.update({0, 0, 0}, multiply(pitched, axis_angle(0, 0, 1, -3.0 * i * dt)), i * dt,
+                             velocity, angular);
+
+        CHECK_NEAR(angular[0], 0.0, 1e-9);
+        CHECK_NEAR(angular[1], 0.0, 1e-9);
+        CHECK_NEAR(angular[2], -3.0, 1e-9);
+    }
+
+    // q and -q are the same orientation: a sign flip between samples isn't a full turn
+    {
+        PoseEstimator estimator(0.0);
+        const auto q0 = axis_angle(0, 0, 1, 0.0);
+        auto q1 = axis_angle(0, 0, 1, 0.01);
+        q1 = {-q1.w, -q1.x, -q1.y, -q1.z};
+
+        estimator.update({0, 0, 0}, q0, 0.0, velocity, angular);
+        estimator.update({0, 0, 0}, q1, dt, velocity, angular);
+        CHECK_NEAR(angular[2], 1.0, 1e-9);
+    }
+
+    // Smoothing: a velocity step is approached geometrically, the first estimate is taken as is
+    {
+        PoseEstimator estimator(0.5);
+        auto x = 0.0;
+        for (auto i = 0; i <= 5; i++, x += 1.0 * dt)
+            estimator.update({x, 0, 0}, {1, 0, 0, 0}, i * dt, velocity, angular);
+        CHECK_NEAR(velocity[0], 1.0, 1e-9);
+
+        double expected = 1.0;
+        x -= 1.0 * dt; // Back to the last sample
+        for (auto i = 6; i <= 12; i++)
+        {
+            x += 3.0 * dt;
+            estimator.update({x, 0, 0}, {1, 0, 0, 0}, i * dt, velocity, angular);
+            expected = 0.5 * expected + 0.5 * 3.0;
+            CHECK_NEAR(velocity[0], expected, 1e-9);
+        }
+    }
+
+    // Samples closer than min_dt keep the estimate, gaps over max_dt restart it
+    {
+        PoseEstimator estimator(0.0);
+        estimator.update({0, 0, 0}, {1, 0, 0, 0}, 0.0, velocity, angular);
+        estimator.update({0.01, 0, 0}, {1, 0, 0, 0}, dt, velocity, angular);
+        CHECK_NEAR(velocity[0], 1.0, 1e-9);
+
+        estimator.update({5, 0, 0}, {1, 0, 0, 0}, dt + PoseEstimator::min_dt / 2, velocity, angular);
+        CHECK_NEAR(velocity[0], 1.0, 1e-9);
+
+        estimator.update({5, 0, 0}, {1, 0, 0, 0}, dt + PoseEstimator::max_dt * 2, velocity, angular);
+        CHECK(velocity[0] == 0);
+
+        // Time going backwards (e.g. a new sender) restarts it too
+        estimator.update({6, 0, 0}, {1, 0, 0, 0}, 0.0, velocity, angular);
+        CHECK(velocity[0] == 0);
+        estimator.update({6.02, 0, 0}, {1, 0, 0, 0}, dt, velocity, angular);
+        CHECK_NEAR(velocity[0], 2.0, 1e-9);
+
+        // reset() drops the history like a first sample
+        estimator.reset();
+        estimator.update({100, 0, 0}, {1, 0, 0, 0}, 2 * dt, velocity, angular);
+        CHECK(velocity[0] == 0);
+    }
+
+    return test_result();
+}
@@ -0,0 +1,130 @@
+#include <cmath>
+
+#include "PoseFilter.h"
+#include "check.hpp"
+
+namespace
+{
+    constexpr double dt = 0.01; // 100Hz
+
+    PoseFilterSample make_sample(const double x, const double time, const double yaw = 0.0)
+    {
+        return {{x, 0, 0}, {std::cos(yaw / 2), 0, std::sin(yaw / 2), 0}, time};
+    }
+
+    double yaw_of(const vr::HmdQuaternion_t& q)
+    {
+        return 2 * std::atan2(q.y, q.w);
+    }
+
+    void step_converges()
+    {
+        OneEuroPoseFilter filter;
+
+        // The first sample passes through
+        auto sample = make_sample(0.0, 0.0);
+        filter.apply(sample);
+        CHECK(sample.position[0] == 0.0);
+
+        // Step to 1m / 90deg: approached monotonically without overshoot, settled within a second
+        auto previous = 0.0, previous_yaw = 0.0;
+        auto monotonic = true;
+        for (auto i = 1; i <= 100; i++)
+        {
+            sample = make_sample(1.0, i * dt, std::acos(-1.0) / 2);
+            filter.apply(sample);
+            monotonic &= sample.position[0] >= previous && sample.position[0] <= 1.0 &&
+                yaw_of(sample.rotation) >= previous_yaw - 1e-12;
+            previous = sample.position[0];
+            previous_yaw = yaw_of(sample.rotation);
+        }
+
+        CHECK(monotonic);
+        CHECK_NEAR(sample.position[0], 1.0, 1e-3);
+        CHECK_NEAR(yaw_of(sample.rotation), std::acos(-1.0) / 2, 1e-3);
+    }
+
+    void jitter_is_removed()
+    {
+        // +-1mm alternating noise at rest: the output stays within a fraction of it
+        OneEuroPoseFilter filter;
+        auto worst = 0.0;
+        for (auto i = 0; i < 200; i++)
+        {
+            auto sample = make_sample(i % 2 ? 0.001 : -0.001, i * dt);
+            filter.apply(sample);
+            if (i >= 100) worst = std::fmax(worst, std::abs(sample.position[0]));
+        }
+
+        CHECK(worst < 0.0005);
+    }
+
+    void speed_reduces_lag()
+    {
+        // Constant 1m/s motion: a speed-driven cutoff lags less than a fixed one
+        const auto lag = [](const double beta)
+        {
+            OneEuroPoseFilter filter({1.0, beta, 1.0}, {});
+            PoseFilterSample sample{};
+            for (auto i = 0; i <= 100; i++)
+            {
+                sample = make_sample(i * dt, i * dt);
+                filter.apply(sample);
+            }
+            return 100 * dt - sample.position[0];
+        };
+
+        CHECK(lag(0.0) > 0.0);
+        CHECK(lag(5.0) < lag(0.0) / 2);
+    }
+
+    void gaps_restart()
+    {
+        OneEuroPoseFilter filter;
+        auto sample = make_sample(0.0, 0.0);
+        filter.apply(sample);
+
+        // Past max_dt, or time going backwards: the new sample is taken as is
+        sample = make_sample(5.0, OneEuroPoseFilter::max_dt * 2);
+        filter.apply(sample);
+        CHECK(sample.position[0] == 5.0);
+
+        sample = make_sample(-1.0, 0.0);
+        filter.apply(sample);
+        CHECK(sample.position[0] == -1.0);
+
+        filter.reset();
+        sample = make_sample(3.0, dt);
+        filter.apply(sample);
+        CHECK(sample.position[0] == 3.0);
+    }
+
+    // Records its position in the chain into the sample
+    template <int Id>
+    struct tag_stage
+    {
+        void reset() {}
+
+        void apply(PoseFilterSample& sample) { sample.position[0] = sample.position[0] * 10 + Id; }
+    };
+
+    void chain_order()
+    {
+        PoseFilterChain<tag_stage<1>, tag_stage<2>, tag_stage<3>> chain;
+        PoseFilterSample sample{};
+        chain.apply(sample);
+        CHECK(sample.position[0] == 123.0);
+        chain.reset();
+        CHECK(sample.position[0] == 123.0); // Resetting doesn't touch samples
+    }
+}
+
+int main()
+{
+    step_converges();
+    jitter_is_removed();
+    speed_reduces_lag();
+    gaps_restart();
+    chain_order();
+    return test_result();
+}
@@ -0,0 +1,128 @@
+#include <cmath>
+
+#include "PoseHistory.h"
+#include "check.hpp"
+
+namespace
+{
+    const double pi = std::acos(-1.0);
+
+    vr::HmdQuaternion_t yaw(const double angle)
+    {
+        return {std::cos(angle / 2), 0, std::sin(angle / 2), 0};
+    }
+
+    PoseHistorySample make_sample(const long long time, const double x, const double angle = 0.0)
+    {
+        return {{x, 0, 0}, yaw(angle), {0, 0, 0}, false, time};
+    }
+
+    // Rotation angle between two unit quaternions
+    double angle_between(const vr::HmdQuaternion_t& a, const vr::HmdQuaternion_t& b)
+    {
+        const auto dot = std::abs(a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z);
+        return 2 * std::acos(std::fmin(dot, 1.0));
+    }
+
+    void linear_and_slerp()
+    {
+        PoseHistory history;
+        PoseHistorySample out;
+        CHECK(history.empty());
+        CHECK(!history.sample(0, out));
+
+        // No velocities: position is lerped, rotation slerped
+        history.push(make_sample(10000, 0.0, 0.0));
+        history.push(make_sample(20000, 1.0, pi / 2));
+        CHECK(history.sample(12500, out));
+        CHECK_NEAR(out.position[0], 0.25, 1e-12);
+        CHECK_NEAR(angle_between(out.rotation, yaw(pi / 8)), 0.0, 1e-9);
+        CHECK(!out.has_velocity);
+        CHECK(out.timestamp == 12500);
+
+        // Exactly on a sample
+        CHECK(history.sample(20000, out));
+        CHECK_NEAR(out.position[0], 1.0, 1e-12);
+
+        // No extrapolation: clamped to the ends
+        CHECK(history.sample(0, out));
+        CHECK(out.position[0] == 0.0 && out.timestamp == 10000);
+        CHECK(history.sample(90000, out));
+        CHECK(out.position[0] == 1.0 && out.timestamp == 20000);
+    }
+
+    void hermite()
+    {
+        // Cubic motion with real velocities is reproduced exactly: x = s^3, v = 3s^2 (s in seconds)
+        PoseHistory history;
+        const auto cubic = [](const long long time) -> PoseHistorySample
+        {
+            const auto s = static_cast<double>(time) / 1e6;
+            return {{s * s * s, 0, 0}, yaw(0), {3 * s * s, 0, 0}, true, time};
+        };
+        history.push(cubic(0));
+        history.push(cubic(20000));
+
+        PoseHistorySample out;
+        CHECK(history.sample(5000, out));
+        CHECK_NEAR(out.position[0], 0.005 * 0.005 * 0.005, 1e-15);
+        CHECK(out.has_velocity);
+
+        // One end without a velocity falls back to linear
+        history.push({{1, 0, 0}, yaw(0), {0, 0, 0}, false, 30000});
+        CHECK(history.sample(25000, out));
+        CHECK_NEAR(out.position[0], (0.02 * 0.02 * 0.02 + 1) / 2, 1e-12);
+        CHECK(!out.has_velocity);
+    }
+
+    void ring()
+    {
+        PoseHistory history;
+        PoseHistorySample out;
+
+        // Only the newest `capacity` samples are kept
+        for (std::uint32_t i = 0; i <= PoseHistory::capacity; i++)
+            history.push(make_sample(1000 * (i + 1), i));
+        CHECK(history.sample(0, out));
+        CHECK(out.position[0] == 1.0);
+        CHECK(history.newest().position[0] == PoseHistory::capacity);
+
+        // Interpolates within any pair, not just the newest one
+        CHECK(history.sample(2500, out));
+        CHECK_NEAR(out.position[0], 1.5, 1e-12);
+
+        // Time going backwards (a new sender) restarts the history
+        history.push(make_sample(500, 7.0));
+        CHECK(history.sample(2500, out));
+        CHECK(out.position[0] == 7.0);
+
+        history.clear();
+        CHECK(history.empty());
+    }
+
+    void slerp()
+    {
+        const auto a = yaw(0.0), b = yaw(pi / 2);
+        CHECK_NEAR(angle_between(PoseHistory::slerp(a, b, 0.0), a), 0.0, 1e-9);
+        CHECK_NEAR(angle_between(PoseHistory::slerp(a, b, 1.0), b), 0.0, 1e-9);
+        CHECK_NEAR(angle_between(PoseHistory::slerp(a, b, 0.25), yaw(pi / 8)), 0.0, 1e-9);
+
+        // -b is the same rotation: still the short way round
+        const vr::HmdQuaternion_t negated{-b.w, -b.x, -b.y, -b.z};
+        CHECK_NEAR(angle_between(PoseHistory::slerp(a, negated, 0.5), yaw(pi / 4)), 0.0, 1e-9);
+
+        // Nearly parallel (normalized lerp path) stays unit length and in between
+        const auto tiny = PoseHistory::slerp(a, yaw(1e-4), 0.5);
+        CHECK_NEAR(tiny.w * tiny.w + tiny.x * tiny.x + tiny.y * tiny.y + tiny.z * tiny.z, 1.0, 1e-12);
+        CHECK_NEAR(angle_between(tiny, yaw(0.5e-4)), 0.0, 1e-9);
+    }
+}
+
+int main()
+{
+    linear_and_slerp();
+    hermite();
+    ring();
+    slerp();
+    return test_result();
+}
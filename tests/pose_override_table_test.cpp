@@ -0,0 +1,92 @@
+#include <atomic>
+#include <thread>
+
+#include "DataContract.h"
+#include "PoseOverrideTable.h"
+#include "check.hpp"
+
+namespace
+{
+    dDriverPose make_pose(const float value)
+    {
+        return {true, true, {value, value, value}, {0, 0, 0, value}};
+    }
+
+    void single_thread()
+    {
+        PoseOverrideTable table;
+        dDriverPose pose{};
+
+        // Nothing is overridden by default, poses sent for disabled IDs are dropped
+        CHECK(!table.enabled(0));
+        table.set_pose(0, make_pose(1));
+        CHECK(!table.try_get(0, pose));
+
+        // Enabling starts from an empty pose
+        table.set_enabled(0, true);
+        CHECK(table.enabled(0));
+        CHECK(table.try_get(0, pose));
+        CHECK(!pose.ConnectionState && pose.Position.X == 0);
+
+        table.set_pose(0, make_pose(2));
+        CHECK(table.try_get(0, pose));
+        CHECK(pose.ConnectionState && pose.Position.X == 2 && pose.Orientation.W == 2);
+
+        // IDs don't affect each other, across mask words too
+        const auto last = PoseOverrideTable::size - 1;
+        table.set_enabled(last, true);
+        table.set_pose(last, make_pose(3));
+        CHECK(table.try_get(last, pose) && pose.Position.X == 3);
+        CHECK(table.try_get(0, pose) && pose.Position.X == 2);
+        CHECK(!table.enabled(1));
+
+        // Disabling hides the pose, enabling again doesn't bring the old one back
+        table.set_enabled(0, false);
+        CHECK(!table.try_get(0, pose));
+        table.set_enabled(0, true);
+        CHECK(table.try_get(0, pose) && pose.Position.X == 0);
+        CHECK(table.enabled(last));
+
+        // Out of range IDs are never enabled
+        table.set_enabled(PoseOverrideTable::size, true);
+        table.set_pose(PoseOverrideTable::size, make_pose(4));
+        CHECK(!table.enabled(PoseOverrideTable::size));
+        CHECK(!table.try_get(PoseOverrideTable::size, pose));
+        CHECK(!table.enabled(~0u));
+    }
+
+    // The detour reads while the COM thread writes: every pose seen is one that was set
+    void concurrent_reader()
+    {
+        PoseOverrideTable table;
+        table.set_enabled(5, true);
+
+        std::atomic<bool> done{false};
+        std::thread writer([&]
+        {
+            for (auto i = 1; i <= 200000; i++)
+                table.set_pose(5, make_pose(static_cast<float>(i)));
+            done = true;
+        });
+
+        auto torn = 0, reads = 0;
+        while (!done)
+        {
+            dDriverPose pose{};
+            if (!table.try_get(5, pose)) continue;
+            reads++;
+            if (pose.Position.X != pose.Position.Z || pose.Position.X != pose.Orientation.W) torn++;
+        }
+
+        writer.join();
+        CHECK(reads > 0);
+        CHECK(torn == 0);
+    }
+}
+
+int main()
+{
+    single_thread();
+    concurrent_reader();
+    return test_result();
+}
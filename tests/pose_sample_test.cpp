@@ -0,0 +1,74 @@
+#include <cstring>
+
+#include "PoseSample.h"
+#include "check.hpp"
+
+int main()
+{
+    // Every field set, so a misplaced copy shows up
+    const dPoseSample full{
+        .Role = TrackerWaist,
+        .Flags = PoseSample_Tracked | PoseSample_HasVelocity | PoseSample_HasAcceleration |
+        PoseSample_HasAngularVelocity | PoseSample_HasAngularAcceleration,
+        .Position = {1, 2, 3},
+        .Orientation = {0.5f, -0.5f, 0.5f, -0.5f},
+        .Velocity = {4, 5, 6},
+        .Acceleration = {7, 8, 9},
+        .AngularVelocity = {10, 11, 12},
+        .AngularAcceleration = {13, 14, 15},
+        .Timestamp = 123456789012345
+    };
+
+    auto tracker = expand_pose_sample(full);
+    CHECK(tracker.ConnectionState && tracker.TrackingState);
+    CHECK(tracker.Serial == nullptr);
+    CHECK(tracker.Role == TrackerWaist);
+    CHECK(tracker.Position.X == 1 && tracker.Position.Y == 2 && tracker.Position.Z == 3);
+    CHECK(tracker.Orientation.X == 0.5f && tracker.Orientation.Y == -0.5f &&
+        tracker.Orientation.Z == 0.5f && tracker.Orientation.W == -0.5f);
+    CHECK(tracker.Velocity.HasValue && tracker.Velocity.Value.X == 4 && tracker.Velocity.Value.Z == 6);
+    CHECK(tracker.Acceleration.HasValue && tracker.Acceleration.Value.X == 7 && tracker.Acceleration.Value.Z == 9);
+    CHECK(tracker.AngularVelocity.HasValue && tracker.AngularVelocity.Value.X == 10 &&
+        tracker.AngularVelocity.Value.Z == 12);
+    CHECK(tracker.AngularAcceleration.HasValue && tracker.AngularAcceleration.Value.X == 13 &&
+        tracker.AngularAcceleration.Value.Z == 15);
+    CHECK(tracker.Timestamp == 123456789012345);
+
+    // Each flag maps to its own field, unflagged derivatives are ignored by the tracker
+    auto sparse = full;
+    sparse.Flags = PoseSample_HasAngularVelocity;
+    tracker = expand_pose_sample(sparse);
+    CHECK(tracker.ConnectionState && !tracker.TrackingState);
+    CHECK(!tracker.Velocity.HasValue && !tracker.Acceleration.HasValue && !tracker.AngularAcceleration.HasValue);
+    CHECK(tracker.AngularVelocity.HasValue);
+
+    // The layout the client writes: decoding raw wire bytes gives the same pose
+    unsigned char wire[88] = {};
+    const auto put = [&](const std::size_t offset, const void* value, const std::size_t size)
+    {
+        std::memcpy(wire + offset, value, size);
+    };
+    const unsigned char role = TrackerLeftFoot, flags = PoseSample_Tracked | PoseSample_HasVelocity;
+    const float position[3] = {0.25f, 1.5f, -2}, velocity[3] = {0.5f, 0, -0.5f};
+    const float orientation[4] = {0, 0, 0, 1};
+    const long long timestamp = 42;
+    put(0, &role, 1);
+    put(1, &flags, 1);
+    put(4, position, sizeof position);
+    put(16, orientation, sizeof orientation);
+    put(32, velocity, sizeof velocity);
+    put(80, &timestamp, sizeof timestamp);
+
+    dPoseSample decoded;
+    static_assert(sizeof decoded == sizeof wire);
+    std::memcpy(&decoded, wire, sizeof wire);
+    tracker = expand_pose_sample(decoded);
+    CHECK(tracker.Role == TrackerLeftFoot && tracker.TrackingState);
+    CHECK(tracker.Position.X == 0.25f && tracker.Position.Y == 1.5f && tracker.Position.Z == -2);
+    CHECK(tracker.Orientation.W == 1);
+    CHECK(tracker.Velocity.HasValue && tracker.Velocity.Value.Z == -0.5f);
+    CHECK(!tracker.AngularVelocity.HasValue);
+    CHECK(tracker.Timestamp == 42);
+
+    return test_result();
+}
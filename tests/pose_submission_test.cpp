@@ -0,0 +1,40 @@
+#include "PoseSubmission.h"
+#include "check.hpp"
+
+int main()
+{
+    constexpr long long keep_alive = 50000;
+    PoseSubmission submission;
+
+    // The first pose always goes out
+    CHECK(submission.submitted_at() == 0);
+    CHECK(submission.should_submit(2, 0, true, false, 1000, keep_alive));
+    CHECK(submission.submitted_at() == 1000);
+
+    // Nothing changed: skipped until the keep-alive is due
+    CHECK(!submission.should_submit(2, 0, true, false, 2000, keep_alive));
+    CHECK(!submission.should_submit(2, 0, true, false, 1000 + keep_alive - 1, keep_alive));
+    CHECK(submission.submitted_at() == 1000); // Skips aren't remembered
+    CHECK(submission.should_submit(2, 0, true, false, 1000 + keep_alive, keep_alive));
+
+    auto now = 1000 + keep_alive;
+
+    // Any change goes out on the next frame
+    CHECK(submission.should_submit(4, 0, true, false, ++now, keep_alive)); // New pose
+    CHECK(!submission.should_submit(4, 0, true, false, ++now, keep_alive));
+    CHECK(submission.should_submit(4, 0, false, false, ++now, keep_alive)); // Disconnected
+    CHECK(!submission.should_submit(4, 0, false, false, ++now, keep_alive));
+    CHECK(submission.should_submit(4, 2, false, false, ++now, keep_alive)); // Playspace moved
+    CHECK(!submission.should_submit(4, 2, false, false, ++now, keep_alive));
+
+    // Interpolated output changes every frame with the same sample
+    CHECK(submission.should_submit(4, 2, false, true, ++now, keep_alive));
+    CHECK(submission.should_submit(4, 2, false, true, ++now, keep_alive));
+    CHECK(!submission.should_submit(4, 2, false, false, ++now, keep_alive));
+
+    // reset() (Activate) sends the current state again right away
+    submission.reset();
+    CHECK(submission.should_submit(4, 2, false, false, ++now, keep_alive));
+
+    return test_result();
+}
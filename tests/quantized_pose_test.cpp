@@ -0,0 +1,163 @@
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <random>
+
+#include "DataContract.h"
+#include "QuantizedPose.h"
+#include "check.hpp"
+
+namespace
+{
+    // Every half survives half -> float -> half, and the F16C kernel agrees with the scalar one
+    void half_round_trip()
+    {
+        std::uint32_t mismatches = 0, kernel_mismatches = 0;
+        for (std::uint32_t bits = 0; bits <= 0xFFFF; bits++)
+        {
+            const auto half = static_cast<std::uint16_t>(bits);
+            const auto value = half_to_float(half);
+            const auto is_nan = (half & 0x7C00) == 0x7C00 && (half & 0x3FF) != 0;
+
+            if (is_nan ? !std::isnan(value) : float_to_half(value) != half) mismatches++;
+
+#ifdef AME_QUANTIZED_POSE_F16C
+            if (g_cpu_supports_f16c)
+            {
+                float kernel;
+                decode_halves_f16c(&half, &kernel, 1);
+                std::uint16_t four[4] = {half, half, half, half};
+                float kernel4[4];
+                decode_halves_f16c(four, kernel4, 4);
+
+                const auto same = [&](const float other)
+                {
+                    return is_nan ? std::isnan(other) : std::bit_cast<std::uint32_t>(other) ==
+                                                        std::bit_cast<std::uint32_t>(value);
+                };
+                if (!same(kernel) || !same(kernel4[0]) || !same(kernel4[3])) kernel_mismatches++;
+            }
+#endif
+        }
+
+        CHECK(mismatches == 0);
+        CHECK(kernel_mismatches == 0);
+    }
+
+    void float_to_half_rounding()
+    {
+        CHECK(float_to_half(0.f) == 0x0000);
+        CHECK(float_to_half(-0.f) == 0x8000);
+        CHECK(float_to_half(1.f) == 0x3C00);
+        CHECK(float_to_half(-2.f) == 0xC000);
+        CHECK(float_to_half(65504.f) == 0x7BFF); // Largest half
+        CHECK(float_to_half(65520.f) == 0x7C00); // Rounds up to infinity
+        CHECK(float_to_half(1e10f) == 0x7C00);
+        CHECK(float_to_half(-INFINITY) == 0xFC00);
+        CHECK(std::isnan(half_to_float(float_to_half(NAN))));
+        CHECK(float_to_half(std::ldexp(1.f, -24)) == 0x0001); // Smallest subnormal
+        CHECK(float_to_half(std::ldexp(1.f, -26)) == 0x0000); // Below half of it
+
+        // Ties go to even: 1 + 2^-11 is halfway between 1 and 1 + 2^-10
+        CHECK(float_to_half(1.f + std::ldexp(1.f, -11)) == 0x3C00);
+        CHECK(float_to_half(1.f + 3 * std::ldexp(1.f, -11)) == 0x3C02);
+
+        // Normal range: relative error <= 2^-11
+        std::mt19937 random(11);
+        std::uniform_real_distribution<float> exponent(-14.f, 15.f);
+        auto worst = 0.0;
+        for (auto i = 0; i < 100000; i++)
+        {
+            const auto value = std::exp2(exponent(random)) * (i & 1 ? -1.f : 1.f);
+            worst = std::fmax(worst, std::abs(half_to_float(float_to_half(value)) - value) / std::abs(value));
+        }
+        CHECK(worst <= std::ldexp(1.0, -11));
+    }
+
+    // Smallest three: within 0.01 degrees for any unit quaternion, either sign
+    void rotation_round_trip()
+    {
+        std::mt19937 random(3);
+        std::normal_distribution<float> normal;
+        auto worst = 0.0;
+
+        for (auto i = 0; i < 100000; i++)
+        {
+            float q[4];
+            auto norm = 0.f;
+            for (auto& c : q)
+            {
+                c = normal(random);
+                norm += c * c;
+            }
+            for (auto& c : q) c /= std::sqrt(norm);
+
+            std::uint16_t packed[3];
+            float decoded[4];
+            decode_rotation(packed, encode_rotation(q, packed), decoded);
+
+            // Angle between the rotations: 4 asin(|q1 - q2| / 2) for the closer sign
+            double plus = 0.0, minus = 0.0;
+            for (auto c = 0; c < 4; c++)
+            {
+                plus += std::pow(static_cast<double>(q[c]) - decoded[c], 2);
+                minus += std::pow(static_cast<double>(q[c]) + decoded[c], 2);
+            }
+            const auto angle = 4.0 * std::asin(std::sqrt(std::fmin(plus, minus)) / 2.0);
+            worst = std::fmax(worst, angle * 180.0 / std::numbers::pi);
+        }
+
+        CHECK(worst < 0.01);
+    }
+
+    void pose_round_trip()
+    {
+        dTrackerBase tracker{};
+        tracker.TrackingState = true;
+        tracker.Role = TrackerLeftKnee;
+        tracker.Position = {1.2345f, 0.5f, -3.21f};
+        tracker.Orientation = {0.f, 0.38268343f, 0.f, -0.92387953f};
+        tracker.Velocity = {true, {0.5f, -0.25f, 2.f}};
+        tracker.AngularVelocity = {true, {0.f, 3.14159f, -1.f}};
+        tracker.Acceleration = {false, {9.f, 9.f, 9.f}};
+
+        const dVector3 origin{1.f, 0.f, -3.f};
+        const auto pose = encode_quantized_pose(tracker, origin);
+        const auto decoded = decode_quantized_pose(pose, origin, 42);
+
+        CHECK(decoded.Role == TrackerLeftKnee);
+        CHECK(decoded.TrackingState && decoded.ConnectionState);
+        CHECK(decoded.Timestamp == 42);
+        CHECK(decoded.Serial == nullptr);
+
+        CHECK_NEAR(decoded.Position.X, tracker.Position.X, 0.0005);
+        CHECK_NEAR(decoded.Position.Y, tracker.Position.Y, 0.0005);
+        CHECK_NEAR(decoded.Position.Z, tracker.Position.Z, 0.0005);
+
+        // Same rotation, the sign is normalized
+        const auto dot = decoded.Orientation.X * tracker.Orientation.X + decoded.Orientation.Y * tracker.Orientation.Y +
+            decoded.Orientation.Z * tracker.Orientation.Z + decoded.Orientation.W * tracker.Orientation.W;
+        CHECK_NEAR(std::abs(dot), 1.0, 1e-6);
+
+        CHECK(decoded.Velocity.HasValue && decoded.AngularVelocity.HasValue);
+        CHECK(!decoded.Acceleration.HasValue && !decoded.AngularAcceleration.HasValue);
+        CHECK_NEAR(decoded.Velocity.Value.Z, 2.0, 2.0 / 2048);
+        CHECK_NEAR(decoded.AngularVelocity.Value.Y, 3.14159, 3.14159 / 2048);
+
+        // Positions past +-32.767m from the origin are clamped
+        tracker.Position = {100.f, -100.f, 0.f};
+        const auto far = decode_quantized_pose(encode_quantized_pose(tracker, origin), origin, 0);
+        CHECK_NEAR(far.Position.X, origin.X + 32.767, 1e-4);
+        CHECK_NEAR(far.Position.Y, origin.Y - 32.767, 1e-4);
+    }
+}
+
+int main()
+{
+    half_round_trip();
+    float_to_half_rounding();
+    rotation_round_trip();
+    pose_round_trip();
+    return test_result();
+}
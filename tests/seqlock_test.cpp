@@ -0,0 +1,115 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "seqlock.hpp"
+#include "check.hpp"
+
+namespace
+{
+    // Every word derives from the first one, a torn read breaks the pattern
+    struct payload
+    {
+        std::uint64_t words[12];
+
+        static payload make(const std::uint64_t seed)
+        {
+            payload p{};
+            for (std::uint64_t i = 0; i < 12; i++)
+                p.words[i] = seed * 0x9E3779B97F4A7C15ull + i;
+            return p;
+        }
+
+        [[nodiscard]] bool consistent() const
+        {
+            for (std::uint64_t i = 1; i < 12; i++)
+                if (words[i] != words[0] + i) return false;
+            return true;
+        }
+    };
+
+    void single_thread()
+    {
+        Util::seqlock<payload> lock;
+        CHECK(lock.version() == 0);
+
+        lock.store(payload::make(1));
+        std::uint32_t version = 0;
+        const auto value = lock.load(&version);
+        CHECK(version == 2);
+        CHECK(lock.version() == 2);
+        CHECK(value.words[0] == payload::make(1).words[0]);
+
+        // A writer caught mid-store: readers give up, the next store waits for it
+        lock.sequence.store(3);
+        payload out;
+        CHECK(!lock.try_load(out));
+        CHECK(lock.version() == 2);
+        lock.sequence.store(4);
+        CHECK(lock.try_load(out, &version));
+        CHECK(version == 4);
+
+        // Copies are snapshots, with their own sequence
+        const auto copy = lock;
+        CHECK(copy.load().words[0] == lock.load().words[0]);
+    }
+
+    // Concurrent writers and readers: no torn reads, versions only move forward,
+    // and every store is accounted for in the final sequence
+    void writers_readers()
+    {
+        constexpr std::uint32_t writers = 3, readers = 2, per_writer = 200000;
+        Util::seqlock<payload> lock(payload::make(0));
+
+        std::atomic<bool> done{false};
+        std::atomic<std::uint64_t> torn{0}, backwards{0}, reads{0};
+
+        std::vector<std::thread> threads;
+        for (std::uint32_t r = 0; r < readers; r++)
+            threads.emplace_back([&]
+            {
+                std::uint32_t last = 0;
+                std::uint64_t local_reads = 0;
+                while (!done.load(std::memory_order_relaxed))
+                {
+                    payload out;
+                    std::uint32_t version;
+                    if (!lock.try_load(out, &version)) continue;
+
+                    if (!out.consistent()) torn.fetch_add(1);
+                    if (version < last) backwards.fetch_add(1);
+                    last = version;
+                    local_reads++;
+                }
+                reads.fetch_add(local_reads);
+            });
+
+        std::vector<std::thread> writer_threads;
+        for (std::uint32_t w = 0; w < writers; w++)
+            writer_threads.emplace_back([&, w]
+            {
+                for (std::uint32_t i = 0; i < per_writer; i++)
+                    lock.store(payload::make(std::uint64_t{w} << 32 | i));
+            });
+
+        for (auto& thread : writer_threads)
+            thread.join();
+        done.store(true);
+        for (auto& thread : threads)
+            thread.join();
+
+        CHECK(torn.load() == 0);
+        CHECK(backwards.load() == 0);
+        CHECK(reads.load() > 0);
+        CHECK(lock.version() == 2 * writers * per_writer);
+        CHECK(lock.load().consistent());
+    }
+}
+
+int main()
+{
+    single_thread();
+    writers_readers();
+    return test_result();
+}
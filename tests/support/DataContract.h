@@ -0,0 +1,114 @@
+#pragma once
+#include <cstddef>
+
+// Mirror of the MIDL-generated DataContract.h (driver_00Amethyst/DataContract.idl)
+// for test builds outside MSBuild: the declarations the portable headers use,
+// kept in sync with the IDL.
+typedef unsigned char boolean;
+
+enum dTrackerType
+{
+    TrackerHanded,
+    TrackerLeftFoot,
+    TrackerRightFoot,
+    TrackerLeftShoulder,
+    TrackerRightShoulder,
+    TrackerLeftElbow,
+    TrackerRightElbow,
+    TrackerLeftKnee,
+    TrackerRightKnee,
+    TrackerWaist,
+    TrackerChest,
+    TrackerCamera,
+    TrackerKeyboard,
+    TrackerHead,
+    TrackerLeftHand,
+    TrackerRightHand
+};
+
+struct dVector3
+{
+    float X;
+    float Y;
+    float Z;
+};
+
+struct dVector3Nullable
+{
+    boolean HasValue;
+    dVector3 Value;
+};
+
+struct dQuaternion
+{
+    float X;
+    float Y;
+    float Z;
+    float W;
+};
+
+struct dTrackerBase
+{
+    boolean ConnectionState;
+    boolean TrackingState;
+    char* Serial;
+
+    dTrackerType Role;
+    dVector3 Position;
+    dQuaternion Orientation;
+
+    dVector3Nullable Velocity;
+    dVector3Nullable Acceleration;
+    dVector3Nullable AngularVelocity;
+    dVector3Nullable AngularAcceleration;
+
+    long long Timestamp;
+};
+
+enum dPoseSampleFlags
+{
+    PoseSample_Tracked = 0x01,
+    PoseSample_HasVelocity = 0x02,
+    PoseSample_HasAcceleration = 0x04,
+    PoseSample_HasAngularVelocity = 0x08,
+    PoseSample_HasAngularAcceleration = 0x10
+};
+
+struct dPoseSample
+{
+    unsigned char Role;
+    unsigned char Flags;
+
+    dVector3 Position;
+    dQuaternion Orientation;
+
+    dVector3 Velocity;
+    dVector3 Acceleration;
+    dVector3 AngularVelocity;
+    dVector3 AngularAcceleration;
+
+    long long Timestamp;
+};
+
+struct dQuantizedPose
+{
+    unsigned char Role;
+    unsigned char Flags;
+
+    short Position[3];
+    unsigned short Rotation[3];
+
+    unsigned short Velocity[3];
+    unsigned short Acceleration[3];
+    unsigned short AngularVelocity[3];
+    unsigned short AngularAcceleration[3];
+};
+
+struct dDriverPose
+{
+    boolean ConnectionState;
+    boolean TrackingState;
+
+    dVector3 Position;
+    dQuaternion Orientation;
+};
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstdint>
+
+// The parts of openvr_driver.h used by the header-only driver code, for test
+// builds without the vendor/openvr submodule. Layouts match the real header.
+namespace vr
+{
+    static constexpr std::uint32_t k_unMaxTrackedDeviceCount = 64;
+
+    struct HmdQuaternion_t
+    {
+        double w, x, y, z;
+    };
+
+    struct HmdVector3d_t
+    {
+        double v[3];
+    };
+
+    enum EVRScalarUnits
+    {
+        VRScalarUnits_NormalizedOneSided = 0,
+        VRScalarUnits_NormalizedTwoSided = 1,
+    };
+}
@@ -0,0 +1,99 @@
+#include <cmath>
+
+#include "WorldFromDriver.h"
+#include "check.hpp"
+
+namespace
+{
+    // Rotation by angle (rad) around the unit axis (x, y, z)
+    vr::HmdQuaternion_t axis_angle(const double x, const double y, const double z, const double angle)
+    {
+        const auto s = std::sin(angle / 2);
+        return {std::cos(angle / 2), x * s, y * s, z * s};
+    }
+
+    WorldFromDriverTransform make_transform(const vr::HmdQuaternion_t& rotation,
+                                            const double x, const double y, const double z)
+    {
+        return {.rotation = rotation, .translation = {x, y, z}};
+    }
+
+    void check_position(const double (&actual)[3], const double (&expected)[3])
+    {
+        for (auto i = 0; i < 3; i++)
+            CHECK_NEAR(actual[i], expected[i], 1e-9);
+    }
+
+    // q and -q are the same orientation
+    void check_rotation(const vr::HmdQuaternion_t& actual, const vr::HmdQuaternion_t& expected)
+    {
+        const auto dot = actual.w * expected.w + actual.x * expected.x +
+            actual.y * expected.y + actual.z * expected.z;
+        CHECK_NEAR(std::abs(dot), 1.0, 1e-9);
+    }
+}
+
+int main()
+{
+    const auto pi = std::acos(-1.0);
+    const double position[3] = {0.5, 1.6, -0.3};
+    const auto rotation = axis_angle(0.6, 0.8, 0, 0.7);
+
+    // Known values: 90deg around Y takes +X to -Z, then the translation
+    {
+        const auto transform = make_transform(axis_angle(0, 1, 0, pi / 2), 1, 0, 2);
+        double world[3];
+        transform.apply({1, 0, 0}, world);
+        check_position(world, {1, 0, 1});
+    }
+
+    // The inverse undoes the transform, both ways
+    {
+        const auto transform = make_transform(axis_angle(0, 0.6, 0.8, 1.2), 0.3, -1, 2.5);
+        const WorldFromDriverTransform identity;
+        double world[3], back[3];
+
+        transform.inverse().apply(position, world);
+        transform.apply(world, back);
+        check_position(back, position);
+
+        const auto round_trip = transform.inverse().after(transform);
+        round_trip.apply(position, back);
+        check_position(back, position);
+        check_rotation(round_trip.apply(rotation), rotation);
+        check_rotation(round_trip.rotation, identity.rotation);
+    }
+
+    // An override sent in the client's driver space lands at the same world pose through the device's
+    // own transform, whichever that is
+    {
+        const auto client = make_transform(axis_angle(0, 1, 0, pi / 2), 1, 0, 2);
+        for (const auto& device : {
+                 WorldFromDriverTransform{},
+                 make_transform(axis_angle(0, 1, 0, -pi / 6), 0, 1, 0),
+                 make_transform(axis_angle(0.6, 0, 0.8, 2.5), -3, 0.2, 1)
+             })
+        {
+            const auto to_device = device_from_client(client, device);
+
+            double driver[3], world[3], expected[3];
+            to_device.apply(position, driver);
+            device.apply(driver, world);
+            client.apply(position, expected);
+            check_position(world, expected);
+
+            check_rotation(device.apply(to_device.apply(rotation)), client.apply(rotation));
+        }
+    }
+
+    // Both identity (no playspace calibration anywhere): overrides pass through as is
+    {
+        const auto to_device = device_from_client({}, {});
+        double driver[3];
+        to_device.apply(position, driver);
+        check_position(driver, position);
+        check_rotation(to_device.apply(rotation), rotation);
+    }
+
+    return test_result();
+}